@@ -0,0 +1,6 @@
+\ Ackermann function: deep, irregular recursion
+: ACK
+  OVER 0 = IF SWAP DROP 1 +
+  ELSE DUP 0 = IF DROP 1 - 1 ACK
+  ELSE OVER 1 - ROT ROT 1 - ACK ACK THEN THEN ;
+: BENCH-ACKERMANN 40 0 DO 3 4 ACK DROP LOOP ;
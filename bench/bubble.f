@@ -0,0 +1,12 @@
+\ Bubble sort of 500 cells in reverse order: compare and swap heavy
+VARIABLE BUBBLE HERE BUBBLE ! 500 ALLOT
+: CELL-AT BUBBLE @ + ;
+: BUBBLE-INIT 500 0 DO 500 I - I CELL-AT ! LOOP ;
+: BUBBLE-SORT
+  500 1 DO
+    500 I - 0 DO
+      I CELL-AT @ I 1 + CELL-AT @
+      OVER OVER > IF I CELL-AT ! I 1 + CELL-AT ! ELSE DROP DROP THEN
+    LOOP
+  LOOP ;
+: BENCH-BUBBLE 3 0 DO BUBBLE-INIT BUBBLE-SORT LOOP ;
@@ -0,0 +1,402 @@
+\ Compile 400 definitions of about 30 tokens each: parsing, lookup and compile heavy
+: C000 1 2 3 DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * DROP DROP DROP ;
+: C001 1 2 3 OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + DROP DROP DROP ;
+: C002 1 2 3 SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DROP DROP DROP ;
+: C003 1 2 3 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP DROP DROP DROP ;
+: C004 1 2 3 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DROP DROP DROP ;
+: C005 1 2 3 ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + DROP DROP DROP ;
+: C006 1 2 3 DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - DROP DROP DROP ;
+: C007 1 2 3 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP DROP DROP DROP ;
+: C008 1 2 3 DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * DROP DROP DROP ;
+: C009 1 2 3 OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + DROP DROP DROP ;
+: C010 1 2 3 SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DROP DROP DROP ;
+: C011 1 2 3 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP DROP DROP DROP ;
+: C012 1 2 3 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DROP DROP DROP ;
+: C013 1 2 3 ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + DROP DROP DROP ;
+: C014 1 2 3 DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - DROP DROP DROP ;
+: C015 1 2 3 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP DROP DROP DROP ;
+: C016 1 2 3 DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * DROP DROP DROP ;
+: C017 1 2 3 OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + DROP DROP DROP ;
+: C018 1 2 3 SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DROP DROP DROP ;
+: C019 1 2 3 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP DROP DROP DROP ;
+: C020 1 2 3 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DROP DROP DROP ;
+: C021 1 2 3 ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + DROP DROP DROP ;
+: C022 1 2 3 DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - DROP DROP DROP ;
+: C023 1 2 3 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP DROP DROP DROP ;
+: C024 1 2 3 DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * DROP DROP DROP ;
+: C025 1 2 3 OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + DROP DROP DROP ;
+: C026 1 2 3 SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DROP DROP DROP ;
+: C027 1 2 3 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP DROP DROP DROP ;
+: C028 1 2 3 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DROP DROP DROP ;
+: C029 1 2 3 ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + DROP DROP DROP ;
+: C030 1 2 3 DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - DROP DROP DROP ;
+: C031 1 2 3 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP DROP DROP DROP ;
+: C032 1 2 3 DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * DROP DROP DROP ;
+: C033 1 2 3 OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + DROP DROP DROP ;
+: C034 1 2 3 SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DROP DROP DROP ;
+: C035 1 2 3 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP DROP DROP DROP ;
+: C036 1 2 3 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DROP DROP DROP ;
+: C037 1 2 3 ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + DROP DROP DROP ;
+: C038 1 2 3 DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - DROP DROP DROP ;
+: C039 1 2 3 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP DROP DROP DROP ;
+: C040 1 2 3 DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * DROP DROP DROP ;
+: C041 1 2 3 OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + DROP DROP DROP ;
+: C042 1 2 3 SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DROP DROP DROP ;
+: C043 1 2 3 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP DROP DROP DROP ;
+: C044 1 2 3 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DROP DROP DROP ;
+: C045 1 2 3 ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + DROP DROP DROP ;
+: C046 1 2 3 DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - DROP DROP DROP ;
+: C047 1 2 3 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP DROP DROP DROP ;
+: C048 1 2 3 DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * DROP DROP DROP ;
+: C049 1 2 3 OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + DROP DROP DROP ;
+: C050 1 2 3 SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DROP DROP DROP ;
+: C051 1 2 3 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP DROP DROP DROP ;
+: C052 1 2 3 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DROP DROP DROP ;
+: C053 1 2 3 ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + DROP DROP DROP ;
+: C054 1 2 3 DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - DROP DROP DROP ;
+: C055 1 2 3 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP DROP DROP DROP ;
+: C056 1 2 3 DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * DROP DROP DROP ;
+: C057 1 2 3 OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + DROP DROP DROP ;
+: C058 1 2 3 SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DROP DROP DROP ;
+: C059 1 2 3 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP DROP DROP DROP ;
+: C060 1 2 3 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DROP DROP DROP ;
+: C061 1 2 3 ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + DROP DROP DROP ;
+: C062 1 2 3 DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - DROP DROP DROP ;
+: C063 1 2 3 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP DROP DROP DROP ;
+: C064 1 2 3 DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * DROP DROP DROP ;
+: C065 1 2 3 OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + DROP DROP DROP ;
+: C066 1 2 3 SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DROP DROP DROP ;
+: C067 1 2 3 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP DROP DROP DROP ;
+: C068 1 2 3 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DROP DROP DROP ;
+: C069 1 2 3 ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + DROP DROP DROP ;
+: C070 1 2 3 DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - DROP DROP DROP ;
+: C071 1 2 3 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP DROP DROP DROP ;
+: C072 1 2 3 DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * DROP DROP DROP ;
+: C073 1 2 3 OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + DROP DROP DROP ;
+: C074 1 2 3 SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DROP DROP DROP ;
+: C075 1 2 3 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP DROP DROP DROP ;
+: C076 1 2 3 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DROP DROP DROP ;
+: C077 1 2 3 ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + DROP DROP DROP ;
+: C078 1 2 3 DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - DROP DROP DROP ;
+: C079 1 2 3 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP DROP DROP DROP ;
+: C080 1 2 3 DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * DROP DROP DROP ;
+: C081 1 2 3 OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + DROP DROP DROP ;
+: C082 1 2 3 SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DROP DROP DROP ;
+: C083 1 2 3 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP DROP DROP DROP ;
+: C084 1 2 3 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DROP DROP DROP ;
+: C085 1 2 3 ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + DROP DROP DROP ;
+: C086 1 2 3 DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - DROP DROP DROP ;
+: C087 1 2 3 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP DROP DROP DROP ;
+: C088 1 2 3 DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * DROP DROP DROP ;
+: C089 1 2 3 OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + DROP DROP DROP ;
+: C090 1 2 3 SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DROP DROP DROP ;
+: C091 1 2 3 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP DROP DROP DROP ;
+: C092 1 2 3 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DROP DROP DROP ;
+: C093 1 2 3 ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + DROP DROP DROP ;
+: C094 1 2 3 DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - DROP DROP DROP ;
+: C095 1 2 3 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP DROP DROP DROP ;
+: C096 1 2 3 DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * DROP DROP DROP ;
+: C097 1 2 3 OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + DROP DROP DROP ;
+: C098 1 2 3 SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DROP DROP DROP ;
+: C099 1 2 3 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP DROP DROP DROP ;
+: C100 1 2 3 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DROP DROP DROP ;
+: C101 1 2 3 ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + DROP DROP DROP ;
+: C102 1 2 3 DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - DROP DROP DROP ;
+: C103 1 2 3 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP DROP DROP DROP ;
+: C104 1 2 3 DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * DROP DROP DROP ;
+: C105 1 2 3 OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + DROP DROP DROP ;
+: C106 1 2 3 SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DROP DROP DROP ;
+: C107 1 2 3 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP DROP DROP DROP ;
+: C108 1 2 3 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DROP DROP DROP ;
+: C109 1 2 3 ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + DROP DROP DROP ;
+: C110 1 2 3 DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - DROP DROP DROP ;
+: C111 1 2 3 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP DROP DROP DROP ;
+: C112 1 2 3 DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * DROP DROP DROP ;
+: C113 1 2 3 OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + DROP DROP DROP ;
+: C114 1 2 3 SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DROP DROP DROP ;
+: C115 1 2 3 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP DROP DROP DROP ;
+: C116 1 2 3 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DROP DROP DROP ;
+: C117 1 2 3 ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + DROP DROP DROP ;
+: C118 1 2 3 DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - DROP DROP DROP ;
+: C119 1 2 3 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP DROP DROP DROP ;
+: C120 1 2 3 DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * DROP DROP DROP ;
+: C121 1 2 3 OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + DROP DROP DROP ;
+: C122 1 2 3 SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DROP DROP DROP ;
+: C123 1 2 3 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP DROP DROP DROP ;
+: C124 1 2 3 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DROP DROP DROP ;
+: C125 1 2 3 ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + DROP DROP DROP ;
+: C126 1 2 3 DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - DROP DROP DROP ;
+: C127 1 2 3 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP DROP DROP DROP ;
+: C128 1 2 3 DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * DROP DROP DROP ;
+: C129 1 2 3 OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + DROP DROP DROP ;
+: C130 1 2 3 SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DROP DROP DROP ;
+: C131 1 2 3 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP DROP DROP DROP ;
+: C132 1 2 3 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DROP DROP DROP ;
+: C133 1 2 3 ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + DROP DROP DROP ;
+: C134 1 2 3 DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - DROP DROP DROP ;
+: C135 1 2 3 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP DROP DROP DROP ;
+: C136 1 2 3 DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * DROP DROP DROP ;
+: C137 1 2 3 OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + DROP DROP DROP ;
+: C138 1 2 3 SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DROP DROP DROP ;
+: C139 1 2 3 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP DROP DROP DROP ;
+: C140 1 2 3 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DROP DROP DROP ;
+: C141 1 2 3 ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + DROP DROP DROP ;
+: C142 1 2 3 DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - DROP DROP DROP ;
+: C143 1 2 3 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP DROP DROP DROP ;
+: C144 1 2 3 DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * DROP DROP DROP ;
+: C145 1 2 3 OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + DROP DROP DROP ;
+: C146 1 2 3 SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DROP DROP DROP ;
+: C147 1 2 3 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP DROP DROP DROP ;
+: C148 1 2 3 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DROP DROP DROP ;
+: C149 1 2 3 ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + DROP DROP DROP ;
+: C150 1 2 3 DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - DROP DROP DROP ;
+: C151 1 2 3 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP DROP DROP DROP ;
+: C152 1 2 3 DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * DROP DROP DROP ;
+: C153 1 2 3 OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + DROP DROP DROP ;
+: C154 1 2 3 SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DROP DROP DROP ;
+: C155 1 2 3 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP DROP DROP DROP ;
+: C156 1 2 3 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DROP DROP DROP ;
+: C157 1 2 3 ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + DROP DROP DROP ;
+: C158 1 2 3 DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - DROP DROP DROP ;
+: C159 1 2 3 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP DROP DROP DROP ;
+: C160 1 2 3 DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * DROP DROP DROP ;
+: C161 1 2 3 OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + DROP DROP DROP ;
+: C162 1 2 3 SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DROP DROP DROP ;
+: C163 1 2 3 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP DROP DROP DROP ;
+: C164 1 2 3 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DROP DROP DROP ;
+: C165 1 2 3 ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + DROP DROP DROP ;
+: C166 1 2 3 DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - DROP DROP DROP ;
+: C167 1 2 3 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP DROP DROP DROP ;
+: C168 1 2 3 DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * DROP DROP DROP ;
+: C169 1 2 3 OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + DROP DROP DROP ;
+: C170 1 2 3 SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DROP DROP DROP ;
+: C171 1 2 3 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP DROP DROP DROP ;
+: C172 1 2 3 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DROP DROP DROP ;
+: C173 1 2 3 ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + DROP DROP DROP ;
+: C174 1 2 3 DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - DROP DROP DROP ;
+: C175 1 2 3 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP DROP DROP DROP ;
+: C176 1 2 3 DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * DROP DROP DROP ;
+: C177 1 2 3 OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + DROP DROP DROP ;
+: C178 1 2 3 SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DROP DROP DROP ;
+: C179 1 2 3 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP DROP DROP DROP ;
+: C180 1 2 3 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DROP DROP DROP ;
+: C181 1 2 3 ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + DROP DROP DROP ;
+: C182 1 2 3 DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - DROP DROP DROP ;
+: C183 1 2 3 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP DROP DROP DROP ;
+: C184 1 2 3 DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * DROP DROP DROP ;
+: C185 1 2 3 OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + DROP DROP DROP ;
+: C186 1 2 3 SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DROP DROP DROP ;
+: C187 1 2 3 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP DROP DROP DROP ;
+: C188 1 2 3 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DROP DROP DROP ;
+: C189 1 2 3 ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + DROP DROP DROP ;
+: C190 1 2 3 DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - DROP DROP DROP ;
+: C191 1 2 3 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP DROP DROP DROP ;
+: C192 1 2 3 DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * DROP DROP DROP ;
+: C193 1 2 3 OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + DROP DROP DROP ;
+: C194 1 2 3 SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DROP DROP DROP ;
+: C195 1 2 3 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP DROP DROP DROP ;
+: C196 1 2 3 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DROP DROP DROP ;
+: C197 1 2 3 ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + DROP DROP DROP ;
+: C198 1 2 3 DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - DROP DROP DROP ;
+: C199 1 2 3 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP DROP DROP DROP ;
+: C200 1 2 3 DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * DROP DROP DROP ;
+: C201 1 2 3 OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + DROP DROP DROP ;
+: C202 1 2 3 SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DROP DROP DROP ;
+: C203 1 2 3 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP DROP DROP DROP ;
+: C204 1 2 3 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DROP DROP DROP ;
+: C205 1 2 3 ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + DROP DROP DROP ;
+: C206 1 2 3 DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - DROP DROP DROP ;
+: C207 1 2 3 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP DROP DROP DROP ;
+: C208 1 2 3 DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * DROP DROP DROP ;
+: C209 1 2 3 OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + DROP DROP DROP ;
+: C210 1 2 3 SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DROP DROP DROP ;
+: C211 1 2 3 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP DROP DROP DROP ;
+: C212 1 2 3 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DROP DROP DROP ;
+: C213 1 2 3 ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + DROP DROP DROP ;
+: C214 1 2 3 DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - DROP DROP DROP ;
+: C215 1 2 3 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP DROP DROP DROP ;
+: C216 1 2 3 DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * DROP DROP DROP ;
+: C217 1 2 3 OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + DROP DROP DROP ;
+: C218 1 2 3 SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DROP DROP DROP ;
+: C219 1 2 3 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP DROP DROP DROP ;
+: C220 1 2 3 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DROP DROP DROP ;
+: C221 1 2 3 ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + DROP DROP DROP ;
+: C222 1 2 3 DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - DROP DROP DROP ;
+: C223 1 2 3 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP DROP DROP DROP ;
+: C224 1 2 3 DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * DROP DROP DROP ;
+: C225 1 2 3 OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + DROP DROP DROP ;
+: C226 1 2 3 SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DROP DROP DROP ;
+: C227 1 2 3 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP DROP DROP DROP ;
+: C228 1 2 3 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DROP DROP DROP ;
+: C229 1 2 3 ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + DROP DROP DROP ;
+: C230 1 2 3 DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - DROP DROP DROP ;
+: C231 1 2 3 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP DROP DROP DROP ;
+: C232 1 2 3 DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * DROP DROP DROP ;
+: C233 1 2 3 OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + DROP DROP DROP ;
+: C234 1 2 3 SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DROP DROP DROP ;
+: C235 1 2 3 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP DROP DROP DROP ;
+: C236 1 2 3 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DROP DROP DROP ;
+: C237 1 2 3 ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + DROP DROP DROP ;
+: C238 1 2 3 DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - DROP DROP DROP ;
+: C239 1 2 3 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP DROP DROP DROP ;
+: C240 1 2 3 DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * DROP DROP DROP ;
+: C241 1 2 3 OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + DROP DROP DROP ;
+: C242 1 2 3 SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DROP DROP DROP ;
+: C243 1 2 3 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP DROP DROP DROP ;
+: C244 1 2 3 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DROP DROP DROP ;
+: C245 1 2 3 ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + DROP DROP DROP ;
+: C246 1 2 3 DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - DROP DROP DROP ;
+: C247 1 2 3 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP DROP DROP DROP ;
+: C248 1 2 3 DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * DROP DROP DROP ;
+: C249 1 2 3 OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + DROP DROP DROP ;
+: C250 1 2 3 SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DROP DROP DROP ;
+: C251 1 2 3 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP DROP DROP DROP ;
+: C252 1 2 3 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DROP DROP DROP ;
+: C253 1 2 3 ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + DROP DROP DROP ;
+: C254 1 2 3 DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - DROP DROP DROP ;
+: C255 1 2 3 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP DROP DROP DROP ;
+: C256 1 2 3 DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * DROP DROP DROP ;
+: C257 1 2 3 OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + DROP DROP DROP ;
+: C258 1 2 3 SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DROP DROP DROP ;
+: C259 1 2 3 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP DROP DROP DROP ;
+: C260 1 2 3 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DROP DROP DROP ;
+: C261 1 2 3 ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + DROP DROP DROP ;
+: C262 1 2 3 DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - DROP DROP DROP ;
+: C263 1 2 3 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP DROP DROP DROP ;
+: C264 1 2 3 DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * DROP DROP DROP ;
+: C265 1 2 3 OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + DROP DROP DROP ;
+: C266 1 2 3 SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DROP DROP DROP ;
+: C267 1 2 3 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP DROP DROP DROP ;
+: C268 1 2 3 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DROP DROP DROP ;
+: C269 1 2 3 ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + DROP DROP DROP ;
+: C270 1 2 3 DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - DROP DROP DROP ;
+: C271 1 2 3 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP DROP DROP DROP ;
+: C272 1 2 3 DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * DROP DROP DROP ;
+: C273 1 2 3 OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + DROP DROP DROP ;
+: C274 1 2 3 SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DROP DROP DROP ;
+: C275 1 2 3 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP DROP DROP DROP ;
+: C276 1 2 3 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DROP DROP DROP ;
+: C277 1 2 3 ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + DROP DROP DROP ;
+: C278 1 2 3 DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - DROP DROP DROP ;
+: C279 1 2 3 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP DROP DROP DROP ;
+: C280 1 2 3 DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * DROP DROP DROP ;
+: C281 1 2 3 OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + DROP DROP DROP ;
+: C282 1 2 3 SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DROP DROP DROP ;
+: C283 1 2 3 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP DROP DROP DROP ;
+: C284 1 2 3 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DROP DROP DROP ;
+: C285 1 2 3 ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + DROP DROP DROP ;
+: C286 1 2 3 DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - DROP DROP DROP ;
+: C287 1 2 3 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP DROP DROP DROP ;
+: C288 1 2 3 DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * DROP DROP DROP ;
+: C289 1 2 3 OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + DROP DROP DROP ;
+: C290 1 2 3 SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DROP DROP DROP ;
+: C291 1 2 3 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP DROP DROP DROP ;
+: C292 1 2 3 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DROP DROP DROP ;
+: C293 1 2 3 ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + DROP DROP DROP ;
+: C294 1 2 3 DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - DROP DROP DROP ;
+: C295 1 2 3 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP DROP DROP DROP ;
+: C296 1 2 3 DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * DROP DROP DROP ;
+: C297 1 2 3 OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + DROP DROP DROP ;
+: C298 1 2 3 SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DROP DROP DROP ;
+: C299 1 2 3 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP DROP DROP DROP ;
+: C300 1 2 3 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DROP DROP DROP ;
+: C301 1 2 3 ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + DROP DROP DROP ;
+: C302 1 2 3 DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - DROP DROP DROP ;
+: C303 1 2 3 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP DROP DROP DROP ;
+: C304 1 2 3 DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * DROP DROP DROP ;
+: C305 1 2 3 OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + DROP DROP DROP ;
+: C306 1 2 3 SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DROP DROP DROP ;
+: C307 1 2 3 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP DROP DROP DROP ;
+: C308 1 2 3 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DROP DROP DROP ;
+: C309 1 2 3 ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + DROP DROP DROP ;
+: C310 1 2 3 DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - DROP DROP DROP ;
+: C311 1 2 3 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP DROP DROP DROP ;
+: C312 1 2 3 DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * DROP DROP DROP ;
+: C313 1 2 3 OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + DROP DROP DROP ;
+: C314 1 2 3 SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DROP DROP DROP ;
+: C315 1 2 3 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP DROP DROP DROP ;
+: C316 1 2 3 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DROP DROP DROP ;
+: C317 1 2 3 ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + DROP DROP DROP ;
+: C318 1 2 3 DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - DROP DROP DROP ;
+: C319 1 2 3 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP DROP DROP DROP ;
+: C320 1 2 3 DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * DROP DROP DROP ;
+: C321 1 2 3 OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + DROP DROP DROP ;
+: C322 1 2 3 SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DROP DROP DROP ;
+: C323 1 2 3 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP DROP DROP DROP ;
+: C324 1 2 3 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DROP DROP DROP ;
+: C325 1 2 3 ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + DROP DROP DROP ;
+: C326 1 2 3 DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - DROP DROP DROP ;
+: C327 1 2 3 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP DROP DROP DROP ;
+: C328 1 2 3 DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * DROP DROP DROP ;
+: C329 1 2 3 OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + DROP DROP DROP ;
+: C330 1 2 3 SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DROP DROP DROP ;
+: C331 1 2 3 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP DROP DROP DROP ;
+: C332 1 2 3 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DROP DROP DROP ;
+: C333 1 2 3 ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + DROP DROP DROP ;
+: C334 1 2 3 DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - DROP DROP DROP ;
+: C335 1 2 3 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP DROP DROP DROP ;
+: C336 1 2 3 DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * DROP DROP DROP ;
+: C337 1 2 3 OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + DROP DROP DROP ;
+: C338 1 2 3 SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DROP DROP DROP ;
+: C339 1 2 3 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP DROP DROP DROP ;
+: C340 1 2 3 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DROP DROP DROP ;
+: C341 1 2 3 ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + DROP DROP DROP ;
+: C342 1 2 3 DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - DROP DROP DROP ;
+: C343 1 2 3 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP DROP DROP DROP ;
+: C344 1 2 3 DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * DROP DROP DROP ;
+: C345 1 2 3 OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + DROP DROP DROP ;
+: C346 1 2 3 SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DROP DROP DROP ;
+: C347 1 2 3 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP DROP DROP DROP ;
+: C348 1 2 3 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DROP DROP DROP ;
+: C349 1 2 3 ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + DROP DROP DROP ;
+: C350 1 2 3 DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - DROP DROP DROP ;
+: C351 1 2 3 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP DROP DROP DROP ;
+: C352 1 2 3 DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * DROP DROP DROP ;
+: C353 1 2 3 OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + DROP DROP DROP ;
+: C354 1 2 3 SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DROP DROP DROP ;
+: C355 1 2 3 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP DROP DROP DROP ;
+: C356 1 2 3 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DROP DROP DROP ;
+: C357 1 2 3 ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + DROP DROP DROP ;
+: C358 1 2 3 DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - DROP DROP DROP ;
+: C359 1 2 3 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP DROP DROP DROP ;
+: C360 1 2 3 DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * DROP DROP DROP ;
+: C361 1 2 3 OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + DROP DROP DROP ;
+: C362 1 2 3 SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DROP DROP DROP ;
+: C363 1 2 3 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP DROP DROP DROP ;
+: C364 1 2 3 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DROP DROP DROP ;
+: C365 1 2 3 ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + DROP DROP DROP ;
+: C366 1 2 3 DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - DROP DROP DROP ;
+: C367 1 2 3 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP DROP DROP DROP ;
+: C368 1 2 3 DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * DROP DROP DROP ;
+: C369 1 2 3 OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + DROP DROP DROP ;
+: C370 1 2 3 SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DROP DROP DROP ;
+: C371 1 2 3 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP DROP DROP DROP ;
+: C372 1 2 3 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DROP DROP DROP ;
+: C373 1 2 3 ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + DROP DROP DROP ;
+: C374 1 2 3 DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - DROP DROP DROP ;
+: C375 1 2 3 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP DROP DROP DROP ;
+: C376 1 2 3 DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * DROP DROP DROP ;
+: C377 1 2 3 OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + DROP DROP DROP ;
+: C378 1 2 3 SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DROP DROP DROP ;
+: C379 1 2 3 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP DROP DROP DROP ;
+: C380 1 2 3 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DROP DROP DROP ;
+: C381 1 2 3 ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + DROP DROP DROP ;
+: C382 1 2 3 DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - DROP DROP DROP ;
+: C383 1 2 3 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP DROP DROP DROP ;
+: C384 1 2 3 DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * DROP DROP DROP ;
+: C385 1 2 3 OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + DROP DROP DROP ;
+: C386 1 2 3 SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DROP DROP DROP ;
+: C387 1 2 3 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP DROP DROP DROP ;
+: C388 1 2 3 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DROP DROP DROP ;
+: C389 1 2 3 ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + DROP DROP DROP ;
+: C390 1 2 3 DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - DROP DROP DROP ;
+: C391 1 2 3 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP DROP DROP DROP ;
+: C392 1 2 3 DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * DROP DROP DROP ;
+: C393 1 2 3 OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + DROP DROP DROP ;
+: C394 1 2 3 SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DROP DROP DROP ;
+: C395 1 2 3 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP DROP DROP DROP ;
+: C396 1 2 3 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DROP DROP DROP ;
+: C397 1 2 3 ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + DROP DROP DROP ;
+: C398 1 2 3 DUP DROP 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - DROP DROP DROP ;
+: C399 1 2 3 7 MOD DUP + OVER - SWAP DROP 3 * 1 + ROT ROT ROT DUP DROP 7 MOD DUP + OVER - SWAP DROP DROP DROP DROP ;
+: BENCH-COMPILE ;
@@ -0,0 +1,3 @@
+\ Recursive Fibonacci: call and return heavy
+: FIB DUP 2 < IF ELSE DUP 1 - FIB SWAP 2 - FIB + THEN ;
+: BENCH-FIB 27 FIB DROP ;
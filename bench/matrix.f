@@ -0,0 +1,20 @@
+\ 30x30 integer matrix multiply: nested loops and address arithmetic
+VARIABLE MA HERE MA ! 900 ALLOT
+VARIABLE MB HERE MB ! 900 ALLOT
+VARIABLE MC HERE MC ! 900 ALLOT
+VARIABLE ROW
+: MATRIX-INIT 900 0 DO I 7 MOD MA @ I + ! I 5 MOD MB @ I + ! LOOP ;
+: MATRIX-MUL
+  30 0 DO I ROW !
+    30 0 DO
+      0
+      30 0 DO
+        MA @ ROW @ 30 * + I + @
+        MB @ I 30 * + J + @
+        * +
+      LOOP
+      MC @ ROW @ 30 * + I + !
+    LOOP
+  LOOP ;
+MATRIX-INIT
+: BENCH-MATRIX 20 0 DO MATRIX-MUL LOOP ;
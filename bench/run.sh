@@ -0,0 +1,87 @@
+#!/bin/sh
+# Run the benchmark suite and print the results as JSON.
+#
+# Usage: bench/run.sh [-n runs] [-o results.json] [name ...]
+#
+# Each bench/<name>.f defines BENCH-<NAME>. One run loads the file into a
+# fresh interpreter and executes that word; the wall time covers the whole
+# process, recorded as "method": "process" in the JSON. Instructions retired are measured once per benchmark with
+# `perf stat` when perf is available, and are null otherwise.
+set -e
+
+dir=$(cd "$(dirname "$0")" && pwd)
+forth=${FORTH:-$dir/../forth_mini}
+runs=10
+out=
+
+while getopts n:o: opt; do
+    case $opt in
+        n) runs=$OPTARG ;;
+        o) out=$OPTARG ;;
+        *) echo "usage: $0 [-n runs] [-o results.json] [name ...]" >&2; exit 2 ;;
+    esac
+done
+shift $((OPTIND - 1))
+
+if [ ! -x "$forth" ]; then
+    echo "$forth not found; build it first or set FORTH" >&2
+    exit 1
+fi
+
+names=$*
+if [ -z "$names" ]; then
+    names=$(cd "$dir" && ls *.f | sed 's/\.f$//')
+fi
+
+input=$(mktemp)
+times=$(mktemp)
+perfout=$(mktemp)
+trap 'rm -f "$input" "$times" "$perfout"' EXIT
+
+json="{\"method\": \"process\", \"runs\": $runs, \"benchmarks\": ["
+sep=
+printf '%-12s %14s %14s %16s\n' benchmark median_ns p99_ns instructions >&2
+for name in $names; do
+    upper=$(echo "$name" | tr '[:lower:]' '[:upper:]')
+    { cat "$dir/$name.f"; echo "BENCH-$upper"; } > "$input"
+
+    : > "$times"
+    i=0
+    while [ "$i" -lt "$runs" ]; do
+        start=$(date +%s%N)
+        "$forth" < "$input" > /dev/null
+        end=$(date +%s%N)
+        echo $((end - start)) >> "$times"
+        i=$((i + 1))
+    done
+    set -- $(sort -n "$times" | awk '
+        { v[NR] = $1 }
+        END {
+            m = int((NR + 1) / 2)
+            p = int(NR * 0.99); if (p < NR * 0.99) p++
+            print v[m], v[p]
+        }')
+    median=$1
+    p99=$2
+
+    instructions=null
+    if command -v perf > /dev/null 2>&1 &&
+       perf stat -x, -e instructions -o "$perfout" "$forth" < "$input" > /dev/null 2>&1; then
+        n=$(awk -F, '$3 ~ /^instructions/ { print $1 }' "$perfout")
+        case $n in
+            ''|*[!0-9]*) ;;
+            *) instructions=$n ;;
+        esac
+    fi
+
+    printf '%-12s %14s %14s %16s\n' "$name" "$median" "$p99" "$instructions" >&2
+    json="$json$sep{\"name\": \"$name\", \"median_ns\": $median, \"p99_ns\": $p99, \"instructions\": $instructions}"
+    sep=", "
+done
+json="$json]}"
+
+if [ -n "$out" ]; then
+    echo "$json" > "$out"
+else
+    echo "$json"
+fi
@@ -0,0 +1,15 @@
+\ Sieve of Eratosthenes over 8191 flags: memory and loop heavy
+VARIABLE SIEVE HERE SIEVE ! 8191 ALLOT
+: FLAGS SIEVE @ ;
+: PRIMES
+  8191 0 DO 1 FLAGS I + ! LOOP
+  0
+  8191 0 DO
+    FLAGS I + @ IF
+      I I + 3 +
+      DUP I +
+      BEGIN DUP 8191 < WHILE 0 OVER FLAGS + ! OVER + REPEAT
+      DROP DROP 1 +
+    THEN
+  LOOP ;
+: BENCH-SIEVE 40 0 DO PRIMES DROP LOOP ;
@@ -0,0 +1,7 @@
+\ Copy a 4096-character string, one character per cell
+VARIABLE SRC HERE SRC ! 4096 ALLOT
+VARIABLE DST HERE DST ! 4096 ALLOT
+: STRING-INIT 4096 0 DO I 26 MOD 65 + SRC @ I + ! LOOP ;
+: STRING-COPY 4096 0 DO SRC @ I + @ DST @ I + ! LOOP ;
+STRING-INIT
+: BENCH-STRCOPY 200 0 DO STRING-COPY LOOP ;
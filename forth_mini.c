@@ -28,19 +28,81 @@
 #include <string.h>
 #include <ctype.h>
 #include <stdint.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sched.h>
+#include <ucontext.h>
+#include <errno.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <sys/mman.h>
+#include <sys/timerfd.h>
+#include <sys/epoll.h>
+#include <time.h>
+#include <setjmp.h>
+#include <limits.h>
+#include <malloc.h>
+#include <sys/time.h>
+#include <sys/syscall.h>
+#include <sys/ioctl.h>
+#include <linux/perf_event.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+// USDT probes for bpftrace and perf probe. With <sys/sdt.h> each probe is
+// a nop until a tracer attaches; without it they compile to nothing.
+#if defined(__has_include)
+#if __has_include(<sys/sdt.h>)
+#include <sys/sdt.h>
+#endif
+#endif
+#ifndef DTRACE_PROBE1
+#define DTRACE_PROBE1(provider, name, a)
+#define DTRACE_PROBE2(provider, name, a, b)
+#define DTRACE_PROBE3(provider, name, a, b, c)
+#endif
 
 #define STACK_SIZE 256
 #define DICT_SIZE 1024
 #define WORD_SIZE 32
 #define INPUT_SIZE 256
+#define MAX_CHANNELS 64
+#define MEMORY_SIZE 65536
+#define PAR_MIN_CHUNK 1024
+#define MAX_COROUTINES 1024
+#define COROUTINE_CSTACK (8 << 20)  // Like the main thread; committed lazily
+#define MAX_WORKERS 256
+#define JOB_BACKLOG 256
+#define MAX_ACTORS 1024
+#define ACTOR_MAILBOX 1024
+#define ACTOR_BATCH 64
+#define MAX_TIMERS 4096
+#define WHEEL_SLOTS 512
+#define MAX_FUTURES 1024
+#define MAX_FRAMES 256
+#define SAMPLE_SLOTS 4096
+#define SAMPLE_DEPTH 32
+#define TRACE_SIZE 4096  // Power of two
+#define NGRAM_SLOTS 16384  // Power of two
 
-// Data stack
-int stack[STACK_SIZE];
-int sp = 0;
+// Data stack (per thread, so pool workers get their own). The stack
+// pointers are switched when a coroutine is resumed.
+_Thread_local int thread_stack[STACK_SIZE];
+_Thread_local int *stack;
+_Thread_local int sp = 0;
 
 // Return stack (for control flow)
-int rstack[STACK_SIZE];
-int rsp = 0;
+_Thread_local int thread_rstack[STACK_SIZE];
+_Thread_local int *rstack;
+_Thread_local int rsp = 0;
+
+// Deepest stack use seen on this thread, for STATS
+_Thread_local int sp_max = 0;
+_Thread_local int rsp_max = 0;
 
 // Dictionary entry
 typedef struct Word {
@@ -49,10 +111,13 @@ typedef struct Word {
     void (*code)(void);
     void **data;  // Changed to void** to store pointers properly
     int data_len;
+    int xt;  // Execution token: index into xt_table
     struct Word *next;
 } Word;
 
 Word *dictionary = NULL;
+Word *xt_table[DICT_SIZE];
+int xt_count = 0;
 Word *current_word = NULL;
 
 // Compilation state
@@ -61,23 +126,73 @@ void **compile_buffer = NULL;  // Changed to void**
 int compile_pos = 0;
 int compile_size = 0;
 
+// Control-flow stack used while compiling. Each entry is a position in the
+// definition being compiled, tagged with the kind of word that opened it,
+// so a structure can only be closed by a matching word.
+#define CF_DEPTH 64
+#define CF_ORIG 1  // Unresolved forward branch from IF, ELSE or WHILE
+#define CF_DEST 2  // Loop start from BEGIN
+#define CF_DO 3    // Loop start from DO
+
+typedef struct ControlEntry {
+    int kind;
+    int pos;
+} ControlEntry;
+
+ControlEntry cf_stack[CF_DEPTH];
+int cf_depth = 0;
+
 // Input buffer
 char input[INPUT_SIZE];
 char *input_ptr;
 
+// Recovery point for runtime errors. Without one, errors end the process.
+_Thread_local jmp_buf *abort_point = NULL;
+
+void vm_abort() {
+    DTRACE_PROBE2(forth_mini, error, sp, rsp);
+    if (abort_point) {
+        longjmp(*abort_point, 1);
+    }
+    exit(1);
+}
+
+// Run fn(arg) under a recovery point of its own. Returns 0 if it aborted;
+// the caller then decides whether to pass the error on with vm_abort().
+int run_caught(void (*fn)(void *), void *arg) {
+    jmp_buf point;
+    jmp_buf *saved = abort_point;
+    if (setjmp(point) != 0) {
+        abort_point = saved;
+        return 0;
+    }
+    abort_point = &point;
+    fn(arg);
+    abort_point = saved;
+    return 1;
+}
+
 // Stack operations
+void init_stacks() {
+    stack = thread_stack;
+    rstack = thread_rstack;
+    sp = 0;
+    rsp = 0;
+}
+
 void push(int val) {
     if (sp >= STACK_SIZE) {
         printf("Stack overflow!\n");
-        exit(1);
+        vm_abort();
     }
     stack[sp++] = val;
+    if (sp > sp_max) sp_max = sp;
 }
 
 int pop() {
     if (sp <= 0) {
         printf("Stack underflow!\n");
-        exit(1);
+        vm_abort();
     }
     return stack[--sp];
 }
@@ -85,15 +200,16 @@ int pop() {
 void rpush(int val) {
     if (rsp >= STACK_SIZE) {
         printf("Return stack overflow!\n");
-        exit(1);
+        vm_abort();
     }
     rstack[rsp++] = val;
+    if (rsp > rsp_max) rsp_max = rsp;
 }
 
 int rpop() {
     if (rsp <= 0) {
         printf("Return stack underflow!\n");
-        exit(1);
+        vm_abort();
     }
     return rstack[--rsp];
 }
@@ -104,7 +220,7 @@ void sub() { int b = pop(); int a = pop(); push(a - b); }
 void mul() { int b = pop(); int a = pop(); push(a * b); }
 void divide() { int b = pop(); int a = pop(); push(a / b); }
 void mod() { int b = pop(); int a = pop(); push(a % b); }
-void dup() { int a = stack[sp-1]; push(a); }
+void duplicate() { int a = stack[sp-1]; push(a); }
 void drop() { pop(); }
 void swap() { int a = pop(); int b = pop(); push(a); push(b); }
 void over() { int a = pop(); int b = pop(); push(b); push(a); push(b); }
@@ -126,6 +242,172 @@ void and() { int b = pop(); int a = pop(); push(a & b); }
 void or() { int b = pop(); int a = pop(); push(a | b); }
 void not() { push(~pop()); }
 
+// Channels: bounded lock-free ring buffers. Capacity is rounded up to a
+// power of two. SPSC channels only need the head/tail pair; MPMC channels
+// add a sequence number per slot so several threads can claim slots with
+// CAS. A full or empty channel parks the caller on a condition variable.
+typedef struct Channel {
+    _Alignas(64) _Atomic unsigned head;  // next slot to read
+    _Alignas(64) _Atomic unsigned tail;  // next slot to write
+    _Alignas(64) _Atomic int waiters;
+    unsigned mask;
+    int mpmc;
+    int *buf;
+    _Atomic unsigned *seq;  // per-slot sequence (MPMC only)
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+} Channel;
+
+Channel *channels[MAX_CHANNELS];
+int channel_count = 0;
+
+Channel* chan_new(int capacity, int mpmc) {
+    unsigned size = 1;
+    while (size < (unsigned)capacity) size <<= 1;
+
+    Channel *c = aligned_alloc(64, sizeof(Channel));
+    atomic_init(&c->head, 0);
+    atomic_init(&c->tail, 0);
+    atomic_init(&c->waiters, 0);
+    c->mask = size - 1;
+    c->mpmc = mpmc;
+    c->buf = malloc(size * sizeof(int));
+    c->seq = NULL;
+    if (mpmc) {
+        c->seq = malloc(size * sizeof(*c->seq));
+        for (unsigned i = 0; i < size; i++) atomic_init(&c->seq[i], i);
+    }
+    pthread_mutex_init(&c->lock, NULL);
+    pthread_cond_init(&c->cond, NULL);
+    return c;
+}
+
+int chan_try_send(Channel *c, int val) {
+    if (!c->mpmc) {
+        unsigned tail = atomic_load_explicit(&c->tail, memory_order_relaxed);
+        unsigned head = atomic_load_explicit(&c->head, memory_order_acquire);
+        if (tail - head > c->mask) return 0;
+        c->buf[tail & c->mask] = val;
+        atomic_store_explicit(&c->tail, tail + 1, memory_order_release);
+        return 1;
+    }
+    unsigned pos = atomic_load_explicit(&c->tail, memory_order_relaxed);
+    for (;;) {
+        unsigned seq = atomic_load_explicit(&c->seq[pos & c->mask], memory_order_acquire);
+        int diff = (int)(seq - pos);
+        if (diff == 0) {
+            if (atomic_compare_exchange_weak_explicit(&c->tail, &pos, pos + 1,
+                    memory_order_relaxed, memory_order_relaxed)) break;
+        } else if (diff < 0) {
+            return 0;
+        } else {
+            pos = atomic_load_explicit(&c->tail, memory_order_relaxed);
+        }
+    }
+    c->buf[pos & c->mask] = val;
+    atomic_store_explicit(&c->seq[pos & c->mask], pos + 1, memory_order_release);
+    return 1;
+}
+
+int chan_try_recv(Channel *c, int *val) {
+    if (!c->mpmc) {
+        unsigned head = atomic_load_explicit(&c->head, memory_order_relaxed);
+        unsigned tail = atomic_load_explicit(&c->tail, memory_order_acquire);
+        if (head == tail) return 0;
+        *val = c->buf[head & c->mask];
+        atomic_store_explicit(&c->head, head + 1, memory_order_release);
+        return 1;
+    }
+    unsigned pos = atomic_load_explicit(&c->head, memory_order_relaxed);
+    for (;;) {
+        unsigned seq = atomic_load_explicit(&c->seq[pos & c->mask], memory_order_acquire);
+        int diff = (int)(seq - (pos + 1));
+        if (diff == 0) {
+            if (atomic_compare_exchange_weak_explicit(&c->head, &pos, pos + 1,
+                    memory_order_relaxed, memory_order_relaxed)) break;
+        } else if (diff < 0) {
+            return 0;
+        } else {
+            pos = atomic_load_explicit(&c->head, memory_order_relaxed);
+        }
+    }
+    *val = c->buf[pos & c->mask];
+    atomic_store_explicit(&c->seq[pos & c->mask], pos + c->mask + 1, memory_order_release);
+    return 1;
+}
+
+// Sleep until the channel may have changed. Waiters register before the
+// re-check, and chan_wake() only takes the lock when someone is registered,
+// so the uncontended path never touches the mutex.
+void chan_park(Channel *c, int sending) {
+    atomic_fetch_add(&c->waiters, 1);
+    pthread_mutex_lock(&c->lock);
+    unsigned head = atomic_load(&c->head);
+    unsigned tail = atomic_load(&c->tail);
+    if (sending ? tail - head > c->mask : head == tail) {
+        pthread_cond_wait(&c->cond, &c->lock);
+    }
+    pthread_mutex_unlock(&c->lock);
+    atomic_fetch_sub(&c->waiters, 1);
+}
+
+void chan_wake(Channel *c) {
+    atomic_thread_fence(memory_order_seq_cst);
+    if (atomic_load_explicit(&c->waiters, memory_order_relaxed) > 0) {
+        pthread_mutex_lock(&c->lock);
+        pthread_cond_broadcast(&c->cond);
+        pthread_mutex_unlock(&c->lock);
+    }
+}
+
+void chan_free(Channel *c) {
+    pthread_mutex_destroy(&c->lock);
+    pthread_cond_destroy(&c->cond);
+    free(c->seq);
+    free(c->buf);
+    free(c);
+}
+
+void chan_send(Channel *c, int val) {
+    while (!chan_try_send(c, val)) chan_park(c, 1);
+    chan_wake(c);
+}
+
+int chan_recv(Channel *c) {
+    int val;
+    while (!chan_try_recv(c, &val)) chan_park(c, 0);
+    chan_wake(c);
+    return val;
+}
+
+Channel* pop_channel() {
+    int id = pop();
+    if (id < 0 || id >= channel_count) {
+        printf("Invalid channel: %d\n", id);
+        vm_abort();
+    }
+    return channels[id];
+}
+
+void make_channel(int mpmc) {
+    int capacity = pop();
+    if (capacity <= 0) {
+        printf("Error: channel capacity must be positive\n");
+        return;
+    }
+    if (channel_count >= MAX_CHANNELS) {
+        printf("Error: too many channels\n");
+        return;
+    }
+    channels[channel_count] = chan_new(capacity, mpmc);
+    push(channel_count++);
+}
+
+void channel() { make_channel(0); }
+void mpmc_channel() { make_channel(1); }
+void channel_send() { Channel *c = pop_channel(); chan_send(c, pop()); }
+void channel_recv() { push(chan_recv(pop_channel())); }
+
 // Dictionary operations
 Word* find_word(const char *name) {
     Word *w = dictionary;
@@ -135,10 +417,15 @@ Word* find_word(const char *name) {
         }
         w = w->next;
     }
+    DTRACE_PROBE1(forth_mini, lookup__miss, name);
     return NULL;
 }
 
 void add_word(const char *name, void (*code)(void), int immediate) {
+    if (xt_count >= DICT_SIZE) {
+        printf("Dictionary full!\n");
+        vm_abort();
+    }
     Word *w = malloc(sizeof(Word));
     strncpy(w->name, name, WORD_SIZE-1);
     w->name[WORD_SIZE-1] = '\0';
@@ -146,17 +433,170 @@ void add_word(const char *name, void (*code)(void), int immediate) {
     w->code = code;
     w->data = NULL;
     w->data_len = 0;
+    w->xt = xt_count;
+    xt_table[xt_count++] = w;
     w->next = dictionary;
     dictionary = w;
 }
 
-void execute_word(Word *w) {
+// Read the next whitespace-delimited name from the input line
+int parse_name(char *name) {
+    if (sscanf(input_ptr, "%31s", name) != 1) {
+        return 0;
+    }
+    input_ptr = strstr(input_ptr, name) + strlen(name);
+    return 1;
+}
+
+// Parse a file name argument for word, which may be longer than a word
+// name. Reports the error itself and returns 0 if there is none or it does
+// not fit.
+int parse_path(char *path, size_t size, const char *word) {
+    while (isspace((unsigned char)*input_ptr)) input_ptr++;
+    size_t len = 0;
+    while (input_ptr[len] && !isspace((unsigned char)input_ptr[len])) len++;
+    if (len == 0) {
+        printf("Error: expected file name after %s\n", word);
+        return 0;
+    }
+    input_ptr += len;
+    if (len >= size) {
+        printf("Error: file name too long\n");
+        return 0;
+    }
+    memcpy(path, input_ptr - len, len);
+    path[len] = '\0';
+    return 1;
+}
+
+// Numbers are tagged with the low bit set inside compiled code
+void *tag_number(int num) {
+    return (void*)(((intptr_t)num << 1) | 1);
+}
+
+// Execution hooks. execute_word() only leaves the plain path when some
+// hook is enabled on this thread, so disabled instrumentation costs a
+// single test per word.
+#define HOOK_FUEL 1
+#define HOOK_PROFILE 2
+#define HOOK_SAMPLE 4
+#define HOOK_TRACE 8
+#define HOOK_PERF 16
+#define HOOK_PAIRS 32
+#define HOOK_CHROME 64
+
+_Thread_local int hooks = 0;
+_Thread_local long fuel = 0;  // Calls left before the VM is stopped
+
+// Per-word profile, indexed by execution token. Kept out of Word so the
+// frozen base dictionary stays read-only.
+typedef struct WordProfile {
+    uint64_t calls;
+    uint64_t incl;  // Cycles including callees, outermost activation only
+    uint64_t self;  // Cycles excluding callees
+    int active;     // Live activations, for recursive words
+} WordProfile;
+
+WordProfile profile[DICT_SIZE];
+_Thread_local uint64_t profile_child = 0;  // Cycles spent in callees
+
+// Hardware counters per word, indexed by execution token. Counts are
+// self counts: what the word spent outside its callees.
+#define PERF_EVENTS 4
+
+typedef struct WordCounters {
+    uint64_t calls;
+    uint64_t self[PERF_EVENTS];
+} WordCounters;
+
+WordCounters perf_counts[DICT_SIZE];
+_Thread_local uint64_t perf_child[PERF_EVENTS];
+_Thread_local int perf_fd = -1;           // Group leader
+_Thread_local int perf_slot[PERF_EVENTS];  // Position in a group read, -1 if unavailable
+_Thread_local int perf_opened = 0;
+
+// Read the current counter values into v
+void perf_read(uint64_t *v) {
+    uint64_t buf[1 + PERF_EVENTS];
+    memset(v, 0, PERF_EVENTS * sizeof(uint64_t));
+    if (read(perf_fd, buf, sizeof(buf)) <= 0) return;
+    for (int i = 0; i < PERF_EVENTS; i++) {
+        if (perf_slot[i] >= 0) v[i] = buf[1 + perf_slot[i]];
+    }
+}
+
+// Active words on this thread, innermost last, kept while sampling
+_Thread_local int frames[MAX_FRAMES];
+_Thread_local volatile int frame_depth = 0;
+
+// Execution trace: the most recent TRACE_SIZE word entries on this thread
+typedef struct TraceEvent {
+    int xt;
+    int depth;  // Data stack depth on entry
+    int tos;    // Top of stack on entry, 0 when empty
+} TraceEvent;
+
+_Thread_local TraceEvent trace_ring[TRACE_SIZE];
+_Thread_local unsigned trace_pos = 0;
+
+// CLOCK_MONOTONIC is served from the vDSO, so reading it is not a syscall
+uint64_t now_ns() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + ts.tv_nsec;
+}
+
+// Chrome trace-event export. Every word that runs for at least the
+// threshold becomes one complete ("X") event, written when it returns, so
+// nested calls show as nested slices in chrome://tracing or Perfetto.
+FILE *chrome_file = NULL;
+uint64_t chrome_min_ns = 0;
+uint64_t chrome_start_ns = 0;
+int chrome_events = 0;
+_Thread_local int chrome_tid = 0;
+
+void chrome_event(Word *w, uint64_t start) {
+    uint64_t end = now_ns();
+    if (end - start < chrome_min_ns || !chrome_file) return;
+    if (!chrome_tid) chrome_tid = (int)syscall(SYS_gettid);
+    flockfile(chrome_file);
+    fputs(chrome_events++ ? ",\n{\"name\":\"" : "{\"name\":\"", chrome_file);
+    for (const char *c = w->name; *c; c++) {
+        if (*c == '"' || *c == '\\') putc_unlocked('\\', chrome_file);
+        putc_unlocked(*c, chrome_file);
+    }
+    fprintf(chrome_file, "\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":%d,\"tid\":%d}",
+            (start - chrome_start_ns) / 1000.0, (end - start) / 1000.0, (int)getpid(), chrome_tid);
+    funlockfile(chrome_file);
+}
+
+// Time stamp counter where there is one, nanoseconds otherwise
+uint64_t read_cycles() {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + ts.tv_nsec;
+#endif
+}
+
+// Next cell of the colon definition being run, for words with inline
+// operands such as branches
+_Thread_local void **ip = NULL;
+
+void execute_word(Word *w);
+
+void run_word(Word *w) {
     if (w->code) {
         w->code();
     } else if (w->data) {
         // Execute compiled word
-        for (int i = 0; i < w->data_len; i++) {
-            void *val = w->data[i];
+        void **saved_ip = ip;
+        void **end = w->data + w->data_len;
+        ip = w->data;
+        while (ip < end) {
+            void *val = *ip++;
             // Use pointer tagging: low bit set means it's a number
             if ((uintptr_t)val & 1) {
                 // It's a number - decode it
@@ -167,6 +607,467 @@ void execute_word(Word *w) {
                 execute_word((Word*)val);
             }
         }
+        ip = saved_ip;
+    }
+}
+
+void out_of_fuel() {
+    fuel = 0;
+    printf("Out of fuel\n");
+    vm_abort();
+}
+
+// Adjacent-item statistics for choosing superinstructions. Items are
+// execution tokens, with NGRAM_LIT standing for an inline literal. A pair
+// is stored as a triple whose first item is NGRAM_NONE.
+#define NGRAM_NONE -1
+#define NGRAM_LIT -2
+
+typedef struct NGram {
+    int a, b, c;
+    uint64_t count;
+} NGram;
+
+typedef struct NGramTable {
+    NGram slots[NGRAM_SLOTS];
+    int used;
+    uint64_t dropped;
+} NGramTable;
+
+NGramTable dynamic_pairs, dynamic_triples;
+
+void count_ngram(NGramTable *t, int a, int b, int c) {
+    uint32_t hash = ((uint32_t)a * 2654435761u) ^ ((uint32_t)b * 40503u) ^ (uint32_t)c;
+    for (int probe = 0; probe < NGRAM_SLOTS; probe++) {
+        NGram *g = &t->slots[(hash + probe) & (NGRAM_SLOTS - 1)];
+        if (g->count == 0) {
+            if (t->used >= NGRAM_SLOTS / 2) break;  // Keep probes short
+            g->a = a;
+            g->b = b;
+            g->c = c;
+            g->count = 1;
+            t->used++;
+            return;
+        }
+        if (g->a == a && g->b == b && g->c == c) {
+            g->count++;
+            return;
+        }
+    }
+    t->dropped++;
+}
+
+// run_word() for a colon definition, also counting the pairs and triples
+// of items in the order they actually run
+void run_body_pairs(Word *w) {
+    void **saved_ip = ip;
+    void **end = w->data + w->data_len;
+    int prev2 = NGRAM_NONE, prev = NGRAM_NONE;
+    ip = w->data;
+    while (ip < end) {
+        void *val = *ip++;
+        int item = ((uintptr_t)val & 1) ? NGRAM_LIT : ((Word*)val)->xt;
+        if (prev != NGRAM_NONE) {
+            count_ngram(&dynamic_pairs, NGRAM_NONE, prev, item);
+            if (prev2 != NGRAM_NONE) count_ngram(&dynamic_triples, prev2, prev, item);
+        }
+        prev2 = prev;
+        prev = item;
+        if ((uintptr_t)val & 1) {
+            push((int)((intptr_t)val >> 1));
+        } else {
+            execute_word((Word*)val);
+        }
+    }
+    ip = saved_ip;
+}
+
+void run_inner(Word *w) {
+    if ((hooks & HOOK_PAIRS) && !w->code && w->data) {
+        run_body_pairs(w);
+    } else {
+        run_word(w);
+    }
+}
+
+void run_profiled(Word *w) {
+    WordProfile *p = &profile[w->xt];
+    uint64_t saved_child = profile_child;
+    profile_child = 0;
+    p->active++;
+    uint64_t start = read_cycles();
+    run_inner(w);
+    uint64_t total = read_cycles() - start;
+    p->calls++;
+    p->self += total - profile_child;
+    if (--p->active == 0) {
+        p->incl += total;
+    }
+    profile_child = saved_child + total;
+}
+
+void run_counted(Word *w) {
+    uint64_t start[PERF_EVENTS], end[PERF_EVENTS], saved[PERF_EVENTS];
+    memcpy(saved, perf_child, sizeof(saved));
+    memset(perf_child, 0, sizeof(perf_child));
+    perf_read(start);
+    if (hooks & HOOK_PROFILE) {
+        run_profiled(w);
+    } else {
+        run_inner(w);
+    }
+    perf_read(end);
+    WordCounters *c = &perf_counts[w->xt];
+    c->calls++;
+    for (int i = 0; i < PERF_EVENTS; i++) {
+        uint64_t total = end[i] - start[i];
+        c->self[i] += total - perf_child[i];
+        perf_child[i] = saved[i] + total;
+    }
+}
+
+void execute_hooked(Word *w) {
+    // Fuel is charged per call into a colon definition
+    if ((hooks & HOOK_FUEL) && !w->code && --fuel < 0) {
+        out_of_fuel();
+    }
+    if (hooks & HOOK_TRACE) {
+        TraceEvent *e = &trace_ring[trace_pos++ & (TRACE_SIZE - 1)];
+        e->xt = w->xt;
+        e->depth = sp;
+        e->tos = sp > 0 ? stack[sp - 1] : 0;
+    }
+    int depth = frame_depth;
+    if (hooks & HOOK_SAMPLE) {
+        if (depth < MAX_FRAMES) frames[depth] = w->xt;
+        atomic_signal_fence(memory_order_seq_cst);
+        frame_depth = depth + 1;
+    }
+    uint64_t start = (hooks & HOOK_CHROME) ? now_ns() : 0;
+    if (hooks & HOOK_PERF) {
+        run_counted(w);
+    } else if (hooks & HOOK_PROFILE) {
+        run_profiled(w);
+    } else {
+        run_inner(w);
+    }
+    if (start && (hooks & HOOK_CHROME)) chrome_event(w, start);
+    frame_depth = depth;
+}
+
+void execute_word(Word *w) {
+    DTRACE_PROBE3(forth_mini, word__entry, w->name, w->xt, sp);
+    if (hooks) {
+        execute_hooked(w);
+    } else {
+        run_word(w);
+    }
+    DTRACE_PROBE3(forth_mini, word__exit, w->name, w->xt, sp);
+}
+
+// FUEL ( n -- ) meters this thread with a budget of n calls; n <= 0 stops
+// metering
+void set_fuel() {
+    int n = pop();
+    fuel = n;
+    if (n > 0) {
+        hooks |= HOOK_FUEL;
+    } else {
+        hooks &= ~HOOK_FUEL;
+    }
+}
+
+void fuel_left() { push((int)fuel); }
+
+// Pool threads have no budget of their own. A metered thread hands what it
+// has left to each task it starts and is charged what the task used when
+// it collects the result. -1 stands for unmetered.
+long task_budget() { return (hooks & HOOK_FUEL) ? fuel : -1; }
+
+// run_caught() with *budget as this thread's fuel; *budget becomes the
+// number of calls used
+int run_metered(void (*fn)(void *), void *arg, long *budget) {
+    if (*budget < 0) return run_caught(fn, arg);
+    int saved_hooks = hooks;
+    long saved_fuel = fuel;
+    hooks |= HOOK_FUEL;
+    fuel = *budget;
+    int ok = run_caught(fn, arg);
+    *budget -= fuel;
+    hooks = (hooks & ~HOOK_FUEL) | (saved_hooks & HOOK_FUEL);
+    fuel = saved_fuel;
+    return ok;
+}
+
+// An overdrawn budget fails at the next call, like one that ran out here
+void charge_fuel(long used) {
+    if (!(hooks & HOOK_FUEL) || used <= 0) return;
+    fuel = fuel > used ? fuel - used : 0;
+}
+
+void profile_on() {
+    memset(profile, 0, sizeof(profile));
+    profile_child = 0;
+    hooks |= HOOK_PROFILE;
+}
+
+void profile_off() { hooks &= ~HOOK_PROFILE; }
+
+int by_self_time(const void *a, const void *b) {
+    uint64_t x = profile[*(const int*)a].self;
+    uint64_t y = profile[*(const int*)b].self;
+    return x < y ? 1 : x > y ? -1 : 0;
+}
+
+void profile_report() {
+    int order[DICT_SIZE];
+    int n = 0;
+    for (int xt = 0; xt < xt_count; xt++) {
+        if (profile[xt].calls) order[n++] = xt;
+    }
+    qsort(order, n, sizeof(int), by_self_time);
+    printf("%-20s %12s %14s %14s %12s\n", "word", "calls", "incl cycles", "self cycles", "avg incl");
+    for (int i = 0; i < n; i++) {
+        WordProfile *p = &profile[order[i]];
+        printf("%-20s %12llu %14llu %14llu %12.1f\n", xt_table[order[i]]->name,
+               (unsigned long long)p->calls, (unsigned long long)p->incl,
+               (unsigned long long)p->self, (double)p->incl / p->calls);
+    }
+}
+
+// PERF-ON attaches cycles, instructions, branch misses and L1D read misses
+// to this thread with perf_event_open. Counters the CPU or kernel refuses
+// are reported as n/a. Reading the group costs a syscall on every word
+// entry and exit, so keep PERF-ON around the code being examined.
+int perf_open(uint32_t type, uint64_t config, int group) {
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = type;
+    attr.config = config;
+    attr.disabled = group < 0;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP;
+    return (int)syscall(SYS_perf_event_open, &attr, 0, -1, group, 0);
+}
+
+void perf_on() {
+    if (!perf_opened) {
+        static const struct { uint32_t type; uint64_t config; } events[PERF_EVENTS] = {
+            { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+            { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+            { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+            { PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D |
+                (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16) },
+        };
+        int opened = 0;
+        for (int i = 0; i < PERF_EVENTS; i++) {
+            int fd = perf_open(events[i].type, events[i].config, perf_fd);
+            perf_slot[i] = fd >= 0 ? opened++ : -1;
+            if (fd >= 0 && perf_fd < 0) perf_fd = fd;
+        }
+        if (perf_fd < 0) {
+            printf("Error: perf_event_open failed: %s\n", strerror(errno));
+            return;
+        }
+        perf_opened = 1;
+    }
+    memset(perf_counts, 0, sizeof(perf_counts));
+    memset(perf_child, 0, sizeof(perf_child));
+    ioctl(perf_fd, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(perf_fd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    hooks |= HOOK_PERF;
+}
+
+void perf_off() {
+    if (perf_fd >= 0) ioctl(perf_fd, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+    hooks &= ~HOOK_PERF;
+}
+
+int by_self_cycles(const void *a, const void *b) {
+    uint64_t x = perf_counts[*(const int*)a].self[0];
+    uint64_t y = perf_counts[*(const int*)b].self[0];
+    return x < y ? 1 : x > y ? -1 : 0;
+}
+
+// Print per-thousand-instruction miss rate, or n/a
+void print_rate(int event, WordCounters *c) {
+    if (perf_slot[event] < 0 || perf_slot[1] < 0 || c->self[1] == 0) {
+        printf(" %10s", "n/a");
+    } else {
+        printf(" %10.2f", 1000.0 * c->self[event] / c->self[1]);
+    }
+}
+
+void perf_report() {
+    int order[DICT_SIZE];
+    int n = 0;
+    for (int xt = 0; xt < xt_count; xt++) {
+        if (perf_counts[xt].calls) order[n++] = xt;
+    }
+    qsort(order, n, sizeof(int), by_self_cycles);
+    printf("%-20s %10s %14s %14s %6s %10s %10s\n", "word", "calls", "cycles",
+           "instructions", "IPC", "br-miss/k", "L1D-miss/k");
+    for (int i = 0; i < n; i++) {
+        WordCounters *c = &perf_counts[order[i]];
+        printf("%-20s %10llu %14llu %14llu", xt_table[order[i]]->name,
+               (unsigned long long)c->calls, (unsigned long long)c->self[0],
+               (unsigned long long)c->self[1]);
+        if (perf_slot[0] >= 0 && perf_slot[1] >= 0 && c->self[0]) {
+            printf(" %6.2f", (double)c->self[1] / c->self[0]);
+        } else {
+            printf(" %6s", "n/a");
+        }
+        print_rate(2, c);
+        print_rate(3, c);
+        printf("\n");
+    }
+}
+
+void trace_on() {
+    trace_pos = 0;
+    hooks |= HOOK_TRACE;
+}
+
+void trace_off() { hooks &= ~HOOK_TRACE; }
+
+// TRACE-DUMP ( n -- ) prints the last n events, oldest first
+void trace_dump() {
+    int n = pop();
+    unsigned count = trace_pos < TRACE_SIZE ? trace_pos : TRACE_SIZE;
+    if (n < 0) n = 0;
+    if ((unsigned)n > count) n = count;
+    for (unsigned i = trace_pos - n; i != trace_pos; i++) {
+        TraceEvent *e = &trace_ring[i & (TRACE_SIZE - 1)];
+        printf("%-20s depth=%d tos=%d\n", e->xt < xt_count ? xt_table[e->xt]->name : "?",
+               e->depth, e->tos);
+    }
+}
+
+void chrome_trace_off() {
+    hooks &= ~HOOK_CHROME;
+    if (chrome_file) {
+        fputs("\n]\n", chrome_file);
+        fclose(chrome_file);
+        chrome_file = NULL;
+    }
+}
+
+// CHROME-TRACE <file> ( min-us -- ) records words that take at least
+// min-us microseconds until CHROME-TRACE-OFF
+void chrome_trace() {
+    int min_us = pop();
+    char path[PATH_MAX];
+    if (!parse_path(path, sizeof(path), "CHROME-TRACE")) return;
+    chrome_trace_off();
+    chrome_file = fopen(path, "w");
+    if (!chrome_file) {
+        printf("Cannot open %s\n", path);
+        return;
+    }
+    fputs("[\n", chrome_file);
+    chrome_min_ns = min_us > 0 ? (uint64_t)min_us * 1000 : 0;
+    chrome_start_ns = now_ns();
+    chrome_events = 0;
+    hooks |= HOOK_CHROME;
+}
+
+// Sampling profiler. SIGPROF fires on CPU time; the handler copies the
+// interrupted thread's active words into a fixed table of distinct stacks,
+// so it never allocates. Stacks deeper than SAMPLE_DEPTH keep their
+// innermost words. SAMPLE-DUMP writes folded stacks for flamegraph tools.
+typedef struct Sample {
+    uint32_t hash;
+    int depth;
+    int count;
+    int xts[SAMPLE_DEPTH];
+} Sample;
+
+Sample samples[SAMPLE_SLOTS];
+volatile sig_atomic_t samples_dropped = 0;
+
+void on_sigprof(int sig) {
+    (void)sig;
+    int depth = frame_depth;
+    if (depth > MAX_FRAMES) depth = MAX_FRAMES;
+    int skip = depth > SAMPLE_DEPTH ? depth - SAMPLE_DEPTH : 0;
+    depth -= skip;
+
+    uint32_t hash = 2166136261u;
+    for (int i = 0; i < depth; i++) {
+        hash = (hash ^ (uint32_t)frames[skip + i]) * 16777619u;
+    }
+    for (int probe = 0; probe < 16; probe++) {
+        Sample *s = &samples[(hash + probe) % SAMPLE_SLOTS];
+        if (s->count == 0) {
+            s->hash = hash;
+            s->depth = depth;
+            memcpy(s->xts, &frames[skip], depth * sizeof(int));
+            s->count = 1;
+            return;
+        }
+        if (s->hash == hash && s->depth == depth &&
+            memcmp(s->xts, &frames[skip], depth * sizeof(int)) == 0) {
+            s->count++;
+            return;
+        }
+    }
+    samples_dropped++;
+}
+
+void set_sample_timer(long usec) {
+    struct itimerval it;
+    it.it_interval.tv_sec = usec / 1000000;
+    it.it_interval.tv_usec = usec % 1000000;
+    it.it_value = it.it_interval;
+    setitimer(ITIMER_PROF, &it, NULL);
+}
+
+// SAMPLE-ON ( hz -- )
+void sample_on() {
+    int hz = pop();
+    if (hz <= 0 || hz > 1000000) {
+        printf("Error: sample rate must be 1..1000000 Hz\n");
+        return;
+    }
+    memset(samples, 0, sizeof(samples));
+    samples_dropped = 0;
+    struct sigaction sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = on_sigprof;
+    sa.sa_flags = SA_RESTART;
+    sigaction(SIGPROF, &sa, NULL);
+    hooks |= HOOK_SAMPLE;
+    set_sample_timer(1000000 / hz);
+}
+
+void sample_off() {
+    set_sample_timer(0);
+    hooks &= ~HOOK_SAMPLE;
+}
+
+// SAMPLE-DUMP <file> writes one "root;outer;...;inner count" line per stack
+void sample_dump() {
+    char path[PATH_MAX];
+    if (!parse_path(path, sizeof(path), "SAMPLE-DUMP")) return;
+    FILE *f = fopen(path, "w");
+    if (!f) {
+        printf("Cannot open %s\n", path);
+        return;
+    }
+    for (int i = 0; i < SAMPLE_SLOTS; i++) {
+        Sample *s = &samples[i];
+        if (s->count == 0) continue;
+        fprintf(f, "forth_mini");
+        for (int k = 0; k < s->depth; k++) {
+            fprintf(f, ";%s", s->xts[k] < xt_count ? xt_table[s->xts[k]]->name : "?");
+        }
+        fprintf(f, " %d\n", s->count);
+    }
+    fclose(f);
+    if (samples_dropped) {
+        printf("%d samples dropped\n", (int)samples_dropped);
     }
 }
 
@@ -176,6 +1077,7 @@ void start_compile() {
     compile_buffer = malloc(compile_size * sizeof(void*));
     compile_pos = 0;
     compiling = 1;
+    cf_depth = 0;
 }
 
 void compile_item(void *val) {
@@ -190,6 +1092,7 @@ void end_compile() {
     if (current_word) {
         current_word->data = compile_buffer;
         current_word->data_len = compile_pos;
+        DTRACE_PROBE2(forth_mini, compile, current_word->name, compile_pos);
     }
     compile_buffer = NULL;
     compile_pos = 0;
@@ -198,25 +1101,41 @@ void end_compile() {
     current_word = NULL;
 }
 
+// Drop the word being defined instead of installing a half-compiled body
+void abandon_compile() {
+    Word *w = current_word;
+    free(compile_buffer);
+    compile_buffer = NULL;
+    compile_pos = 0;
+    compile_size = 0;
+    compiling = 0;
+    current_word = NULL;
+    if (!w) return;
+    if (dictionary == w && w->xt == xt_count - 1) {
+        dictionary = w->next;
+        xt_count--;
+        free(w);
+        return;
+    }
+    // Words created meanwhile keep their execution tokens; only hide it
+    for (Word **link = &dictionary; *link; link = &(*link)->next) {
+        if (*link == w) {
+            *link = w->next;
+            break;
+        }
+    }
+}
+
 // Forth words for compilation
 void colon() {
     char name[WORD_SIZE];
-    if (sscanf(input_ptr, "%s", name) != 1) {
+    if (!parse_name(name)) {
         printf("Error: expected word name after ':'\n");
         return;
     }
-    input_ptr = strstr(input_ptr, name) + strlen(name);
     
-    Word *w = malloc(sizeof(Word));
-    strncpy(w->name, name, WORD_SIZE-1);
-    w->name[WORD_SIZE-1] = '\0';
-    w->is_immediate = 0;
-    w->code = NULL;
-    w->data = NULL;
-    w->data_len = 0;
-    w->next = dictionary;
-    dictionary = w;
-    current_word = w;
+    add_word(name, NULL, 0);
+    current_word = dictionary;
     
     start_compile();
 }
@@ -226,37 +1145,1595 @@ void semicolon() {
         printf("Error: ';' outside definition\n");
         return;
     }
+    if (cf_depth > 0) {
+        printf("Error: unbalanced control structure at ;\n");
+        abandon_compile();
+        return;
+    }
     end_compile();
 }
 
-// Main interpreter
-void interpret(char *input_line) {
-    input_ptr = input_line;
-    char word[WORD_SIZE];
-    
-    while (sscanf(input_ptr, "%s", word) == 1) {
-        input_ptr = strstr(input_ptr, word) + strlen(word);
-        
-        // Try to parse as number
-        char *endptr;
-        long num = strtol(word, &endptr, 10);
-        if (*endptr == '\0') {
-            if (compiling) {
-                // Tag the number with low bit set
-                void *tagged = (void*)((intptr_t)(num << 1) | 1);
-                compile_item(tagged);
-            } else {
-                push((int)num);
-            }
-            continue;
-        }
-        
-        // Look up in dictionary
-        Word *w = find_word(word);
-        if (w) {
-            if (compiling && !w->is_immediate) {
-                compile_item((void*)w);  // Store word pointer
-            } else {
+// Comments
+void line_comment() { input_ptr += strlen(input_ptr); }
+
+void paren_comment() {
+    char *end = strchr(input_ptr, ')');
+    input_ptr = end ? end + 1 : input_ptr + strlen(input_ptr);
+}
+
+// Control flow. Branches are compiled as a branch word followed by a tagged
+// offset from the operand cell to the target. The compiling words keep
+// unresolved positions on the control-flow stack.
+int branch_xt, zbranch_xt, do_xt, loop_xt;
+
+void jump() {
+    intptr_t offset = (intptr_t)*ip >> 1;
+    // Fuel is also charged on backward branches, so loops are metered
+    if (offset < 0 && (hooks & HOOK_FUEL) && --fuel < 0) {
+        out_of_fuel();
+    }
+    ip += offset;
+}
+
+void branch() { jump(); }
+void zero_branch() { if (pop() == 0) jump(); else ip++; }
+void do_runtime() { int start = pop(); int limit = pop(); rpush(limit); rpush(start); }
+
+// Return stack cell n below the top, for words that only make sense
+// inside a DO loop
+int* loop_cell(int n) {
+    if (rsp < n) {
+        printf("Return stack underflow!\n");
+        vm_abort();
+    }
+    return &rstack[rsp - n];
+}
+
+void loop_runtime() {
+    loop_cell(2);
+    if (++rstack[rsp-1] < rstack[rsp-2]) {
+        jump();
+    } else {
+        rsp -= 2;
+        ip++;
+    }
+}
+
+void loop_index() { push(*loop_cell(1)); }
+void outer_index() { push(*loop_cell(3)); }
+
+int check_compiling(const char *name) {
+    if (!compiling) {
+        printf("Error: %s outside definition\n", name);
+    }
+    return compiling;
+}
+
+// A mismatched structure discards the definition and drops the rest of
+// the line, as an unknown word does
+void control_error(const char *name) {
+    printf("Error: unbalanced control structure at %s\n", name);
+    abandon_compile();
+    input_ptr += strlen(input_ptr);
+}
+
+int cf_push(int kind, int pos, const char *name) {
+    if (cf_depth >= CF_DEPTH) {
+        control_error(name);
+        return 0;
+    }
+    cf_stack[cf_depth].kind = kind;
+    cf_stack[cf_depth].pos = pos;
+    cf_depth++;
+    return 1;
+}
+
+// Position opened by a word of the given kind, or -1 after an error
+int cf_pop(int kind, const char *name) {
+    if (cf_depth == 0 || cf_stack[cf_depth - 1].kind != kind) {
+        control_error(name);
+        return -1;
+    }
+    return cf_stack[--cf_depth].pos;
+}
+
+int compile_forward(int xt, const char *name) {
+    if (!cf_push(CF_ORIG, compile_pos + 1, name)) return 0;
+    compile_item(xt_table[xt]);
+    compile_item(tag_number(0));
+    return 1;
+}
+
+void compile_backward(int xt, int dest) {
+    compile_item(xt_table[xt]);
+    compile_item(tag_number(dest - compile_pos));
+}
+
+void resolve_forward(int orig) {
+    compile_buffer[orig] = tag_number(compile_pos - orig);
+}
+
+void if_word() { if (check_compiling("IF")) compile_forward(zbranch_xt, "IF"); }
+
+void else_word() {
+    if (!check_compiling("ELSE")) return;
+    int orig = cf_pop(CF_ORIG, "ELSE");
+    if (orig < 0 || !compile_forward(branch_xt, "ELSE")) return;
+    resolve_forward(orig);
+}
+
+void then_word() {
+    if (!check_compiling("THEN")) return;
+    int orig = cf_pop(CF_ORIG, "THEN");
+    if (orig >= 0) resolve_forward(orig);
+}
+
+void begin_word() { if (check_compiling("BEGIN")) cf_push(CF_DEST, compile_pos, "BEGIN"); }
+
+void until_word() {
+    if (!check_compiling("UNTIL")) return;
+    int dest = cf_pop(CF_DEST, "UNTIL");
+    if (dest >= 0) compile_backward(zbranch_xt, dest);
+}
+
+void again_word() {
+    if (!check_compiling("AGAIN")) return;
+    int dest = cf_pop(CF_DEST, "AGAIN");
+    if (dest >= 0) compile_backward(branch_xt, dest);
+}
+
+void while_word() {
+    if (!check_compiling("WHILE")) return;
+    int dest = cf_pop(CF_DEST, "WHILE");
+    if (dest < 0 || !compile_forward(zbranch_xt, "WHILE")) return;
+    cf_push(CF_DEST, dest, "WHILE");
+}
+
+void repeat_word() {
+    if (!check_compiling("REPEAT")) return;
+    int dest = cf_pop(CF_DEST, "REPEAT");
+    if (dest < 0) return;
+    int orig = cf_pop(CF_ORIG, "REPEAT");
+    if (orig < 0) return;
+    compile_backward(branch_xt, dest);
+    resolve_forward(orig);
+}
+
+void do_word() {
+    if (!check_compiling("DO")) return;
+    if (cf_push(CF_DO, compile_pos + 1, "DO")) compile_item(xt_table[do_xt]);
+}
+
+void loop_word() {
+    if (!check_compiling("LOOP")) return;
+    int dest = cf_pop(CF_DO, "LOOP");
+    if (dest >= 0) compile_backward(loop_xt, dest);
+}
+
+void recurse() { if (check_compiling("RECURSE")) compile_item(current_word); }
+
+// Pair statistics words. The static counts are taken from every compiled
+// body when the report is printed; branch offsets are operands, not items.
+void pairs_on() {
+    memset(&dynamic_pairs, 0, sizeof(dynamic_pairs));
+    memset(&dynamic_triples, 0, sizeof(dynamic_triples));
+    hooks |= HOOK_PAIRS;
+}
+
+void pairs_off() { hooks &= ~HOOK_PAIRS; }
+
+int has_operand(int xt) { return xt == branch_xt || xt == zbranch_xt || xt == loop_xt; }
+
+void count_static(NGramTable *pairs, NGramTable *triples) {
+    for (Word *w = dictionary; w; w = w->next) {
+        int prev2 = NGRAM_NONE, prev = NGRAM_NONE;
+        for (int i = 0; w->data && i < w->data_len; i++) {
+            void *val = w->data[i];
+            int item = ((uintptr_t)val & 1) ? NGRAM_LIT : ((Word*)val)->xt;
+            if (prev != NGRAM_NONE) {
+                count_ngram(pairs, NGRAM_NONE, prev, item);
+                if (prev2 != NGRAM_NONE) count_ngram(triples, prev2, prev, item);
+            }
+            prev2 = prev;
+            prev = item;
+            if (item >= 0 && has_operand(item)) i++;
+        }
+    }
+}
+
+const char *item_name(int item) {
+    if (item == NGRAM_LIT) return "LIT";
+    return item >= 0 && item < xt_count ? xt_table[item]->name : "?";
+}
+
+int by_count(const void *a, const void *b) {
+    uint64_t x = ((const NGram*)a)->count;
+    uint64_t y = ((const NGram*)b)->count;
+    return x < y ? 1 : x > y ? -1 : 0;
+}
+
+void print_ngrams(const char *title, NGramTable *t, int n) {
+    NGram *sorted = malloc(sizeof(NGram) * (t->used ? t->used : 1));
+    int count = 0;
+    for (int i = 0; i < NGRAM_SLOTS; i++) {
+        if (t->slots[i].count) sorted[count++] = t->slots[i];
+    }
+    qsort(sorted, count, sizeof(NGram), by_count);
+    printf("%s\n", title);
+    for (int i = 0; i < count && i < n; i++) {
+        printf("%12llu  ", (unsigned long long)sorted[i].count);
+        if (sorted[i].a != NGRAM_NONE) printf("%s ", item_name(sorted[i].a));
+        printf("%s %s\n", item_name(sorted[i].b), item_name(sorted[i].c));
+    }
+    if (t->dropped) {
+        printf("%12llu  (not recorded, table full)\n", (unsigned long long)t->dropped);
+    }
+}
+
+// PAIRS-REPORT ( n -- ) prints the n most frequent pairs and triples
+void pairs_report() {
+    int n = pop();
+    NGramTable *pairs = calloc(1, sizeof(NGramTable));
+    NGramTable *triples = calloc(1, sizeof(NGramTable));
+    count_static(pairs, triples);
+    print_ngrams("Static pairs:", pairs, n);
+    print_ngrams("Static triples:", triples, n);
+    print_ngrams("Dynamic pairs:", &dynamic_pairs, n);
+    print_ngrams("Dynamic triples:", &dynamic_triples, n);
+    free(pairs);
+    free(triples);
+}
+
+// Data space, addressed in cells
+int memory[MEMORY_SIZE];
+int here = 0;
+
+int* cell_at(int addr) {
+    if (addr < 0 || addr >= MEMORY_SIZE) {
+        printf("Invalid address: %d\n", addr);
+        vm_abort();
+    }
+    return &memory[addr];
+}
+
+void fetch() { push(*cell_at(pop())); }
+void store() { int addr = pop(); *cell_at(addr) = pop(); }
+void here_addr() { push(here); }
+void comma() { *cell_at(here) = pop(); here++; }
+
+void allot() {
+    int n = pop();
+    if (here + n < 0 || here + n > MEMORY_SIZE) {
+        printf("Error: data space exhausted\n");
+        return;
+    }
+    here += n;
+}
+
+// Atomic access to data space cells, for cells shared between threads
+_Atomic int* atomic_cell(int addr) { return (_Atomic int*)cell_at(addr); }
+
+void atomic_fetch() { push(atomic_load(atomic_cell(pop()))); }
+void atomic_store_cell() { int addr = pop(); atomic_store(atomic_cell(addr), pop()); }
+void atomic_add() { int addr = pop(); atomic_fetch_add(atomic_cell(addr), pop()); }
+void fence() { atomic_thread_fence(memory_order_seq_cst); }
+
+void cas() {
+    _Atomic int *cell = atomic_cell(pop());
+    int new_val = pop();
+    int expected = pop();
+    push(atomic_compare_exchange_strong(cell, &expected, new_val) ? -1 : 0);
+}
+
+void variable() {
+    char name[WORD_SIZE];
+    if (!parse_name(name)) {
+        printf("Error: expected word name after VARIABLE\n");
+        return;
+    }
+    add_word(name, NULL, 0);
+    dictionary->data = malloc(sizeof(void*));
+    dictionary->data[0] = tag_number(here);
+    dictionary->data_len = 1;
+    *cell_at(here) = 0;
+    here++;
+}
+
+// Execution tokens
+Word* xt_word(int xt) {
+    if (xt < 0 || xt >= xt_count) {
+        printf("Invalid execution token: %d\n", xt);
+        vm_abort();
+    }
+    return xt_table[xt];
+}
+
+Word* parse_word() {
+    char name[WORD_SIZE];
+    if (!parse_name(name)) {
+        printf("Error: expected word name\n");
+        return NULL;
+    }
+    Word *w = find_word(name);
+    if (!w) {
+        printf("Unknown word: %s\n", name);
+    }
+    return w;
+}
+
+void tick() {
+    Word *w = parse_word();
+    if (w) push(w->xt);
+}
+
+void bracket_tick() {
+    Word *w = parse_word();
+    if (!w) return;
+    if (compiling) {
+        compile_item(tag_number(w->xt));
+    } else {
+        push(w->xt);
+    }
+}
+
+void execute() { execute_word(xt_word(pop())); }
+
+// Thread pool: one worker per online CPU, started on first use
+typedef struct Task {
+    void (*fn)(void *);
+    void *arg;
+    struct Task *next;
+} Task;
+
+pthread_mutex_t pool_lock = PTHREAD_MUTEX_INITIALIZER;
+pthread_cond_t pool_cond = PTHREAD_COND_INITIALIZER;
+Task *pool_head = NULL;
+Task *pool_tail = NULL;
+int pool_size = 0;
+_Thread_local int in_pool = 0;
+
+void *pool_worker(void *unused) {
+    (void)unused;
+    in_pool = 1;
+    init_stacks();
+    while (1) {
+        pthread_mutex_lock(&pool_lock);
+        while (!pool_head) {
+            pthread_cond_wait(&pool_cond, &pool_lock);
+        }
+        Task *t = pool_head;
+        pool_head = t->next;
+        if (!pool_head) pool_tail = NULL;
+        pthread_mutex_unlock(&pool_lock);
+
+        t->fn(t->arg);
+        free(t);
+    }
+    return NULL;
+}
+
+void pool_start() {
+    if (pool_size) return;
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    if (n < 1) n = 1;
+    for (long i = 0; i < n; i++) {
+        pthread_t tid;
+        if (pthread_create(&tid, NULL, pool_worker, NULL) != 0) break;
+        pthread_detach(tid);
+        pool_size++;
+    }
+}
+
+// A forked child has none of the parent's pool threads
+void pool_reset() {
+    pthread_mutex_init(&pool_lock, NULL);
+    pthread_cond_init(&pool_cond, NULL);
+    pool_head = NULL;
+    pool_tail = NULL;
+    pool_size = 0;
+}
+
+void pool_submit(void (*fn)(void *), void *arg) {
+    Task *t = malloc(sizeof(Task));
+    t->fn = fn;
+    t->arg = arg;
+    t->next = NULL;
+    pthread_mutex_lock(&pool_lock);
+    if (pool_tail) {
+        pool_tail->next = t;
+    } else {
+        pool_head = t;
+    }
+    pool_tail = t;
+    pthread_cond_signal(&pool_cond);
+    pthread_mutex_unlock(&pool_lock);
+}
+
+// Parallel array words. The array is split into one chunk per worker; each
+// chunk runs on the worker's own stacks. Small arrays, and calls made from
+// inside a worker, run inline on the calling thread.
+typedef struct Join {
+    int pending;  // Chunks still running on the pool, under lock
+    _Atomic int failed;  // Some chunk's word hit a runtime error
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+} Join;
+
+typedef struct Chunk {
+    Word *w;
+    int start;
+    int end;
+    int reduce;
+    int acc;  // PAR-REDUCE: identity in, partial result out
+    long fuel;  // Budget in, calls used out
+    Join *join;
+} Chunk;
+
+// One allocation holds the Join and the chunks, so nothing a worker
+// touches goes away before the last one has signalled
+typedef struct ParJob {
+    Join join;
+    Chunk chunk[];
+} ParJob;
+
+void run_chunk(Chunk *c) {
+    int base = sp;
+    for (int i = c->start; i < c->end; i++) {
+        if (c->reduce) {
+            push(c->acc);
+            push(memory[i]);
+            execute_word(c->w);
+            c->acc = pop();
+        } else {
+            push(memory[i]);
+            execute_word(c->w);
+            memory[i] = pop();
+        }
+        sp = base;
+    }
+}
+
+void run_chunk_task(void *arg) { run_chunk(arg); }
+
+// Pool threads have no outer recovery point; a chunk that aborts is
+// reported through its Join and par_run() raises the error
+void chunk_task(void *arg) {
+    Chunk *c = arg;
+    int saved_sp = sp, saved_rsp = rsp, depth = frame_depth;
+    if (!run_metered(run_chunk_task, c, &c->fuel)) {
+        atomic_store(&c->join->failed, 1);
+        sp = saved_sp;
+        rsp = saved_rsp;
+        frame_depth = depth;
+    }
+    // The unlock is this worker's last access to the job; par_run() cannot
+    // free it before then
+    Join *join = c->join;
+    pthread_mutex_lock(&join->lock);
+    if (--join->pending == 0) pthread_cond_signal(&join->cond);
+    pthread_mutex_unlock(&join->lock);
+}
+
+// Run w over memory[addr, addr+n) and return the number of chunks used
+int par_run(ParJob **out, int addr, int n, Word *w, int reduce, int identity) {
+    if (n < 0 || addr < 0 || addr > MEMORY_SIZE || n > MEMORY_SIZE - addr) {
+        printf("Invalid array: %d %d\n", addr, n);
+        vm_abort();
+    }
+    int chunks = 1;
+    if (!in_pool && n >= 2 * PAR_MIN_CHUNK) {
+        pool_start();
+        chunks = n / PAR_MIN_CHUNK;
+        if (chunks > pool_size) chunks = pool_size;
+        if (chunks < 1) chunks = 1;
+    }
+
+    ParJob *p = malloc(sizeof(ParJob) + chunks * sizeof(Chunk));
+    Join *join = &p->join;
+    Chunk *c = p->chunk;
+    join->pending = chunks - 1;
+    atomic_init(&join->failed, 0);
+    pthread_mutex_init(&join->lock, NULL);
+    pthread_cond_init(&join->cond, NULL);
+    for (int k = 0; k < chunks; k++) {
+        c[k].w = w;
+        c[k].start = addr + (int)((long)n * k / chunks);
+        c[k].end = addr + (int)((long)n * (k + 1) / chunks);
+        c[k].reduce = reduce;
+        c[k].acc = identity;
+        c[k].fuel = task_budget();
+        c[k].join = join;
+    }
+    for (int k = 1; k < chunks; k++) {
+        pool_submit(chunk_task, &c[k]);
+    }
+    // The other chunks use the job, so an error in this one is passed on
+    // only after they have finished
+    int ok = run_caught(run_chunk_task, &c[0]);
+
+    pthread_mutex_lock(&join->lock);
+    while (join->pending > 0) {
+        pthread_cond_wait(&join->cond, &join->lock);
+    }
+    pthread_mutex_unlock(&join->lock);
+    pthread_mutex_destroy(&join->lock);
+    pthread_cond_destroy(&join->cond);
+    for (int k = 1; k < chunks; k++) {
+        charge_fuel(c[k].fuel);
+    }
+    if (!ok || atomic_load(&join->failed)) {
+        free(p);
+        vm_abort();
+    }
+
+    *out = p;
+    return chunks;
+}
+
+void par_map() {
+    Word *w = xt_word(pop());
+    int n = pop();
+    int addr = pop();
+    ParJob *p;
+    par_run(&p, addr, n, w, 0, 0);
+    free(p);
+}
+
+void par_reduce() {
+    int identity = pop();
+    Word *w = xt_word(pop());
+    int n = pop();
+    int addr = pop();
+    ParJob *p;
+    int chunks = par_run(&p, addr, n, w, 1, identity);
+    int acc = p->chunk[0].acc;
+    for (int k = 1; k < chunks; k++) {
+        push(acc);
+        push(p->chunk[k].acc);
+        execute_word(w);
+        acc = pop();
+    }
+    free(p);
+    push(acc);
+}
+
+// Futures: ASYNC runs a word on the thread pool and AWAIT collects the
+// value it left on top of its stack. The worker sets done and wakes any
+// waiter under the mutex, then sets released as its last access; AWAIT
+// recycles the slot only after released.
+typedef struct Future {
+    Word *w;
+    int value;
+    int failed;  // The word hit a runtime error; AWAIT raises it
+    long fuel;  // Budget in, calls used out
+    _Atomic int done;
+    _Atomic int released;  // The worker no longer touches this slot
+    int in_use;
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+} Future;
+
+Future futures[MAX_FUTURES];
+pthread_mutex_t futures_lock = PTHREAD_MUTEX_INITIALIZER;
+
+void run_future_word(void *arg) {
+    Future *f = arg;
+    int base = sp;
+    execute_word(f->w);
+    f->value = sp > base ? stack[sp - 1] : 0;
+    sp = base;
+}
+
+void run_future(Future *f) {
+    int saved_sp = sp, saved_rsp = rsp, depth = frame_depth;
+    f->failed = !run_metered(run_future_word, f, &f->fuel);
+    if (f->failed) {
+        f->value = 0;
+        sp = saved_sp;
+        rsp = saved_rsp;
+        frame_depth = depth;
+    }
+    pthread_mutex_lock(&f->lock);
+    atomic_store(&f->done, 1);
+    pthread_cond_broadcast(&f->cond);
+    pthread_mutex_unlock(&f->lock);
+    atomic_store_explicit(&f->released, 1, memory_order_release);
+}
+
+void future_task(void *arg) { run_future(arg); }
+
+void async() {
+    Word *w = xt_word(pop());
+    Future *f = NULL;
+    pthread_mutex_lock(&futures_lock);
+    for (int i = 0; i < MAX_FUTURES; i++) {
+        if (!futures[i].in_use) {
+            f = &futures[i];
+            f->in_use = 1;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&futures_lock);
+    if (!f) {
+        printf("Error: too many futures\n");
+        return;
+    }
+    f->w = w;
+    f->fuel = task_budget();
+    atomic_store(&f->done, 0);
+    atomic_store(&f->released, 0);
+    pthread_mutex_init(&f->lock, NULL);
+    pthread_cond_init(&f->cond, NULL);
+
+    // Nested futures run inline so a worker never waits on its own pool
+    if (!in_pool) pool_start();
+    if (in_pool || pool_size == 0) {
+        run_future(f);
+    } else {
+        pool_submit(future_task, f);
+    }
+    push((int)(f - futures));
+}
+
+void await() {
+    int id = pop();
+    if (id < 0 || id >= MAX_FUTURES || !futures[id].in_use) {
+        printf("Invalid future: %d\n", id);
+        vm_abort();
+    }
+    Future *f = &futures[id];
+    if (!atomic_load_explicit(&f->done, memory_order_acquire)) {
+        pthread_mutex_lock(&f->lock);
+        while (!atomic_load(&f->done)) {
+            pthread_cond_wait(&f->cond, &f->lock);
+        }
+        pthread_mutex_unlock(&f->lock);
+    }
+    // The worker may still be leaving the mutex
+    while (!atomic_load_explicit(&f->released, memory_order_acquire)) {
+        sched_yield();
+    }
+    int value = f->value;
+    int failed = f->failed;
+    charge_fuel(f->fuel);
+    pthread_mutex_destroy(&f->lock);
+    pthread_cond_destroy(&f->cond);
+    pthread_mutex_lock(&futures_lock);
+    f->in_use = 0;
+    pthread_mutex_unlock(&futures_lock);
+    if (failed) {
+        printf("Error: future %d failed\n", id);
+        vm_abort();
+    }
+    push(value);
+}
+
+// Coroutines: each has its own data, return and C stacks. RESUME swaps
+// them in with swapcontext() and runs until the body yields or returns.
+typedef struct Coroutine {
+    ucontext_t ctx;
+    ucontext_t caller;
+    Word *w;
+    int stack[STACK_SIZE];
+    int sp;
+    int rstack[STACK_SIZE];
+    int rsp;
+    void **ip;
+    char *cstack;
+    int value;
+    int done;
+    int running;  // Between RESUME and the next YIELD
+    struct Coroutine *resumer;  // The coroutine that resumed this one
+} Coroutine;
+
+Coroutine *coroutines[MAX_COROUTINES];
+int coroutine_count = 0;
+_Thread_local Coroutine *current_co = NULL;
+
+// C stacks are mapped with a PROT_NONE guard page below them, so deep
+// recursion inside a coroutine faults instead of overwriting the heap
+char* cstack_alloc() {
+    long page = sysconf(_SC_PAGESIZE);
+    char *p = mmap(NULL, COROUTINE_CSTACK + page, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE | MAP_STACK, -1, 0);
+    if (p == MAP_FAILED) return NULL;
+    mprotect(p, page, PROT_NONE);
+    return p + page;
+}
+
+void cstack_free(char *cstack) {
+    if (!cstack) return;
+    long page = sysconf(_SC_PAGESIZE);
+    munmap(cstack - page, COROUTINE_CSTACK + page);
+}
+
+void coroutine_entry() {
+    Coroutine *co = current_co;
+    execute_word(co->w);
+    co->value = 0;
+    co->done = 1;
+}
+
+Coroutine* pop_coroutine() {
+    int id = pop();
+    if (id < 0 || id >= coroutine_count) {
+        printf("Invalid coroutine: %d\n", id);
+        vm_abort();
+    }
+    return coroutines[id];
+}
+
+void coroutine() {
+    Word *w = xt_word(pop());
+    if (coroutine_count >= MAX_COROUTINES) {
+        printf("Error: too many coroutines\n");
+        return;
+    }
+    char *cstack = cstack_alloc();
+    if (!cstack) {
+        printf("Error: cannot allocate coroutine stack\n");
+        return;
+    }
+    Coroutine *co = malloc(sizeof(Coroutine));
+    co->w = w;
+    co->sp = 0;
+    co->rsp = 0;
+    co->ip = NULL;
+    co->value = 0;
+    co->done = 0;
+    co->running = 0;
+    co->resumer = NULL;
+    co->cstack = cstack;
+    getcontext(&co->ctx);
+    co->ctx.uc_stack.ss_sp = co->cstack;
+    co->ctx.uc_stack.ss_size = COROUTINE_CSTACK;
+    co->ctx.uc_link = &co->caller;
+    makecontext(&co->ctx, coroutine_entry, 0);
+    coroutines[coroutine_count] = co;
+    push(coroutine_count++);
+}
+
+void resume() {
+    Coroutine *co = pop_coroutine();
+    if (co->done) {
+        printf("Error: coroutine has finished\n");
+        return;
+    }
+    if (co->running) {
+        printf("Error: coroutine is already running\n");
+        return;
+    }
+    int *saved_stack = stack, *saved_rstack = rstack;
+    int saved_sp = sp, saved_rsp = rsp;
+    void **saved_ip = ip;
+    Coroutine *saved_co = current_co;
+
+    stack = co->stack;
+    sp = co->sp;
+    rstack = co->rstack;
+    rsp = co->rsp;
+    ip = co->ip;
+    co->resumer = current_co;
+    co->running = 1;
+    current_co = co;
+    swapcontext(&co->caller, &co->ctx);
+    co->running = 0;
+
+    co->sp = sp;
+    co->rsp = rsp;
+    co->ip = ip;
+    stack = saved_stack;
+    sp = saved_sp;
+    rstack = saved_rstack;
+    rsp = saved_rsp;
+    ip = saved_ip;
+    current_co = saved_co;
+    if (co->done) {
+        cstack_free(co->cstack);
+        co->cstack = NULL;
+    }
+    push(co->value);
+}
+
+void yield() {
+    Coroutine *co = current_co;
+    if (!co) {
+        printf("Error: YIELD outside a coroutine\n");
+        return;
+    }
+    co->value = pop();
+    swapcontext(&co->ctx, &co->caller);
+}
+
+void coroutine_done() { push(pop_coroutine()->done ? -1 : 0); }
+
+// Actors: a word with a mailbox. SEND-TO queues a message and puts the
+// actor on the run queue if it is not there already; dispatch_actors()
+// runs each ready actor on up to ACTOR_BATCH messages at a time.
+typedef struct Actor {
+    Word *w;
+    Channel *mailbox;
+    _Atomic int scheduled;
+} Actor;
+
+Actor *actors[MAX_ACTORS];
+int actor_count = 0;
+Channel *run_queue = NULL;
+
+void schedule_actor(int id) {
+    if (!atomic_exchange(&actors[id]->scheduled, 1)) {
+        chan_send(run_queue, id);
+    }
+}
+
+// Returns the number of messages delivered
+int dispatch_actors() {
+    int delivered = 0;
+    int id;
+    while (run_queue && chan_try_recv(run_queue, &id)) {
+        if (id >= actor_count) continue;  // Dropped by EMPTY
+        Actor *a = actors[id];
+        atomic_store(&a->scheduled, 0);
+        int msg;
+        for (int n = 0; n < ACTOR_BATCH && chan_try_recv(a->mailbox, &msg); n++) {
+            int base = sp;
+            push(msg);
+            execute_word(a->w);
+            sp = base;
+            delivered++;
+        }
+        chan_wake(a->mailbox);
+        if (atomic_load(&a->mailbox->head) != atomic_load(&a->mailbox->tail)) {
+            schedule_actor(id);
+        }
+    }
+    return delivered;
+}
+
+void dispatch() { dispatch_actors(); }
+
+void actor() {
+    Word *w = xt_word(pop());
+    if (actor_count >= MAX_ACTORS) {
+        printf("Error: too many actors\n");
+        return;
+    }
+    if (!run_queue) {
+        run_queue = chan_new(MAX_ACTORS, 1);
+    }
+    Actor *a = malloc(sizeof(Actor));
+    a->w = w;
+    a->mailbox = chan_new(ACTOR_MAILBOX, 1);
+    atomic_init(&a->scheduled, 0);
+    actors[actor_count] = a;
+    push(actor_count++);
+}
+
+void send_to() {
+    int id = pop();
+    if (id < 0 || id >= actor_count) {
+        printf("Invalid actor: %d\n", id);
+        vm_abort();
+    }
+    Actor *a = actors[id];
+    int msg = pop();
+    // A full mailbox is drained here when we are the dispatching thread
+    while (!chan_try_send(a->mailbox, msg)) {
+        if (in_pool) {
+            chan_park(a->mailbox, 1);
+        } else if (!dispatch_actors()) {
+            printf("Error: mailbox full\n");
+            return;
+        }
+    }
+    schedule_actor(id);
+}
+
+// Timers: a hashed timer wheel with 1 ms ticks. A periodic timerfd
+// supplies the ticks while any timer is pending and is disarmed otherwise,
+// so an idle interpreter never wakes up. Callbacks run on the thread that
+// services the event loop: while the REPL or a worker job waits for input,
+// after each input line and inside MS.
+typedef struct Timer {
+    Word *w;
+    int interval;  // ms between runs, 0 for one-shot
+    long expires;  // wheel tick
+    int active;
+    int generation;  // Bumped on every reuse so stale ids cannot cancel it
+    struct Timer *next;
+} Timer;
+
+Timer timers[MAX_TIMERS];
+Timer *free_timers = NULL;
+Timer *wheel[WHEEL_SLOTS];
+long wheel_tick = 0;
+long ticks_owed = 0;  // Read from the timerfd but not yet advanced
+int pending_timers = 0;
+int timer_fd = -1;
+int event_fd = -1;
+
+void arm_ticks(int on) {
+    struct itimerspec its;
+    memset(&its, 0, sizeof(its));
+    if (on) {
+        its.it_interval.tv_nsec = 1000000;
+        its.it_value.tv_nsec = 1000000;
+    }
+    timerfd_settime(timer_fd, 0, &its, NULL);
+}
+
+int timers_init() {
+    if (event_fd >= 0) return 1;
+    timer_fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    event_fd = epoll_create1(EPOLL_CLOEXEC);
+    if (timer_fd < 0 || event_fd < 0) {
+        printf("Error: timers unavailable\n");
+        return 0;
+    }
+    struct epoll_event ev = { .events = EPOLLIN, .data.fd = timer_fd };
+    epoll_ctl(event_fd, EPOLL_CTL_ADD, timer_fd, &ev);
+    for (int i = MAX_TIMERS - 1; i >= 0; i--) {
+        timers[i].next = free_timers;
+        free_timers = &timers[i];
+    }
+    return 1;
+}
+
+void wheel_insert_at(Timer *t, long expires) {
+    t->expires = expires;
+    Timer **slot = &wheel[t->expires % WHEEL_SLOTS];
+    t->next = *slot;
+    *slot = t;
+}
+
+// Counted from the current time, which is ahead of the wheel while it
+// catches up on owed ticks
+void wheel_insert(Timer *t, int ms) {
+    wheel_insert_at(t, wheel_tick + ticks_owed + (ms > 0 ? ms : 1));
+}
+
+// A periodic timer that fell behind skips the periods it missed and runs
+// once, instead of once per missed period
+void reschedule_timer(Timer *t) {
+    long now = wheel_tick + ticks_owed;
+    long next = t->expires + t->interval;
+    if (next <= now) {
+        next += ((now - next) / t->interval + 1) * t->interval;
+    }
+    wheel_insert_at(t, next);
+}
+
+void release_timer(Timer *t) {
+    t->active = 0;
+    t->next = free_timers;
+    free_timers = t;
+    if (--pending_timers == 0) {
+        arm_ticks(0);
+    }
+}
+
+// Timers taken off the wheel whose words have not run yet. Each is
+// rescheduled or released just before its word runs, so an error in a
+// callback leaves the rest here for the next run_events().
+Timer *due_timers = NULL;
+
+void run_due_timers() {
+    while (due_timers) {
+        Timer *t = due_timers;
+        due_timers = t->next;
+        Word *w = t->w;
+        int run = t->active;
+        if (run && t->interval) {
+            reschedule_timer(t);
+        } else {
+            release_timer(t);
+        }
+        if (run) {
+            int base = sp;
+            execute_word(w);
+            sp = base;
+        }
+    }
+}
+
+// Ticks are owed until their slot has been processed, so the ones left
+// when a callback fails are picked up by the next call
+void advance_wheel(long ticks) {
+    ticks_owed += ticks;
+    run_due_timers();
+    while (ticks_owed > 0) {
+        ticks_owed--;
+        wheel_tick++;
+        Timer **link = &wheel[wheel_tick % WHEEL_SLOTS];
+        Timer **due = &due_timers;
+        while (*due) due = &(*due)->next;
+        while (*link) {
+            Timer *t = *link;
+            if (t->active && t->expires > wheel_tick) {
+                link = &t->next;  // Due in a later revolution
+            } else {
+                *link = t->next;
+                t->next = NULL;
+                *due = t;
+                due = &t->next;
+            }
+        }
+        run_due_timers();
+    }
+}
+
+void take_ticks() {
+    uint64_t expirations;
+    if (read(timer_fd, &expirations, sizeof(expirations)) == sizeof(expirations)) {
+        advance_wheel((long)expirations);
+    }
+}
+
+void run_events(int timeout_ms) {
+    advance_wheel(0);  // Left over when a callback failed
+    if (pending_timers > 0 || timeout_ms > 0) {
+        struct epoll_event ev;
+        if (event_fd >= 0 && epoll_wait(event_fd, &ev, 1, timeout_ms) > 0) {
+            take_ticks();
+        } else if (event_fd < 0 && timeout_ms > 0) {
+            usleep(timeout_ms * 1000);
+        }
+    }
+    dispatch_actors();
+}
+
+int add_timer(int ms, Word *w, int interval) {
+    if (!timers_init()) return -1;
+    if (!free_timers) {
+        printf("Error: too many timers\n");
+        return -1;
+    }
+    Timer *t = free_timers;
+    free_timers = t->next;
+    t->w = w;
+    t->interval = interval;
+    t->active = 1;
+    t->generation = (t->generation + 1) % (INT_MAX / MAX_TIMERS);
+    wheel_insert(t, ms);
+    if (pending_timers++ == 0) {
+        arm_ticks(1);
+    }
+    return t->generation * MAX_TIMERS + (int)(t - timers);
+}
+
+void after() { Word *w = xt_word(pop()); add_timer(pop(), w, 0); }
+
+void every() {
+    Word *w = xt_word(pop());
+    int ms = pop();
+    push(add_timer(ms, w, ms > 0 ? ms : 1));
+}
+
+// The slot is reclaimed when the wheel next reaches it. An id carries the
+// slot's generation, so cancelling a timer that already ended is a no-op.
+void cancel() {
+    int id = pop();
+    if (id < 0) return;
+    Timer *t = &timers[id % MAX_TIMERS];
+    if (t->generation == id / MAX_TIMERS) {
+        t->active = 0;
+    }
+}
+
+// Drop every timer and every undelivered actor message, so a worker job
+// leaves nothing behind to run during the next one
+void reset_events() {
+    if (event_fd >= 0) {
+        arm_ticks(0);  // Also discards ticks not yet read
+        memset(wheel, 0, sizeof(wheel));
+        due_timers = NULL;
+        ticks_owed = 0;
+        free_timers = NULL;
+        for (int i = MAX_TIMERS - 1; i >= 0; i--) {
+            timers[i].active = 0;
+            timers[i].next = free_timers;
+            free_timers = &timers[i];
+        }
+        pending_timers = 0;
+    }
+    int id, msg;
+    while (run_queue && chan_try_recv(run_queue, &id)) {}
+    for (int i = 0; i < actor_count; i++) {
+        while (chan_try_recv(actors[i]->mailbox, &msg)) {}
+        atomic_store(&actors[i]->scheduled, 0);
+        chan_wake(actors[i]->mailbox);
+    }
+}
+
+long now_ms() { return (long)(now_ns() / 1000000); }
+
+// Timing words. Cells are 32 bits, so UTIME counts from interpreter start
+// and CYCLES is the low cell of the counter; both are meant for measuring
+// short intervals by subtraction.
+uint64_t epoch_ns = 0;
+
+void utime() { push((int)((now_ns() - epoch_ns) / 1000)); }
+void cycles() { push((int)read_cycles()); }
+
+// BENCH ( xt n -- ) runs xt n times after a warmup of n/10 runs and prints
+// the mean time per run. Whatever xt leaves on the stack is dropped.
+void bench() {
+    int n = pop();
+    Word *w = xt_word(pop());
+    if (n <= 0) {
+        printf("Error: BENCH needs a positive count\n");
+        return;
+    }
+    int base = sp;
+    int warmup = n / 10 > 0 ? n / 10 : 1;
+    for (int i = 0; i < warmup; i++) {
+        execute_word(w);
+        sp = base;
+    }
+    uint64_t start = now_ns();
+    for (int i = 0; i < n; i++) {
+        execute_word(w);
+        sp = base;
+    }
+    printf("%s: %.1f ns/iteration\n", w->name, (double)(now_ns() - start) / n);
+}
+
+// MS ( ms -- ) waits while servicing timers and actors
+void ms() {
+    long deadline = now_ms() + pop();
+    long left;
+    while ((left = deadline - now_ms()) > 0) {
+        run_events((int)left);
+    }
+    run_events(0);
+}
+
+// Shared base dictionary. After the built-ins and libraries are loaded,
+// freeze_base() moves every word and compiled body into one read-only
+// mapping. New definitions form a private overlay in front of it: lookups
+// walk the overlay first and fall through to the base, and forked workers
+// share the base pages without ever dirtying them. EMPTY drops the overlay.
+Word *base_dictionary = NULL;
+int base_xt_count = 0;
+int base_here = 0;
+int base_channels = 0;
+int base_coroutines = 0;
+int base_actors = 0;
+
+void freeze_base() {
+    if (compiling || base_dictionary) return;
+
+    size_t cells = 0;
+    int words = 0;
+    for (Word *w = dictionary; w; w = w->next) {
+        cells += w->data_len;
+        words++;
+    }
+    size_t size = words * sizeof(Word) + cells * sizeof(void*);
+    char *arena = mmap(NULL, size, PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (arena == MAP_FAILED) return;
+
+    // Copy headers first so calls inside bodies can be relocated by xt
+    Word *moved = (Word*)arena;
+    void **bodies = (void**)(arena + words * sizeof(Word));
+    int i = 0;
+    for (Word *w = dictionary; w; w = w->next) {
+        moved[i] = *w;
+        moved[i].next = w->next ? &moved[i + 1] : NULL;
+        i++;
+    }
+    for (i = 0; i < words; i++) {
+        Word *w = &moved[i];
+        xt_table[w->xt] = w;
+    }
+    for (i = 0; i < words; i++) {
+        Word *w = &moved[i];
+        if (!w->data) continue;
+        for (int k = 0; k < w->data_len; k++) {
+            void *val = w->data[k];
+            bodies[k] = ((uintptr_t)val & 1) ? val : xt_table[((Word*)val)->xt];
+        }
+        w->data = bodies;
+        bodies += w->data_len;
+    }
+
+    // Handles made while loading the libraries move to the frozen copies
+    int live = 0;
+    for (i = 0; i < actor_count; i++) {
+        actors[i]->w = xt_table[actors[i]->w->xt];
+    }
+    for (i = 0; i < coroutine_count; i++) {
+        coroutines[i]->w = xt_table[coroutines[i]->w->xt];
+        live |= !coroutines[i]->done;
+    }
+    for (i = 0; i < MAX_TIMERS; i++) {
+        if (timers[i].active) timers[i].w = xt_table[timers[i].w->xt];
+    }
+    pthread_mutex_lock(&futures_lock);
+    for (i = 0; i < MAX_FUTURES; i++) {
+        if (!futures[i].in_use) continue;
+        futures[i].w = xt_table[futures[i].w->xt];
+        live |= !atomic_load(&futures[i].done);
+    }
+    pthread_mutex_unlock(&futures_lock);
+
+    // A suspended coroutine or a running future may still be executing
+    // the old bodies from its own C stack; keep them in that case
+    Word *w = live ? NULL : dictionary;
+    while (w) {
+        Word *next = w->next;
+        free(w->data);
+        free(w);
+        w = next;
+    }
+    mprotect(arena, size, PROT_READ);
+
+    dictionary = words ? &moved[0] : NULL;
+    base_dictionary = dictionary;
+    base_xt_count = xt_count;
+    base_here = here;
+    base_channels = channel_count;
+    base_coroutines = coroutine_count;
+    base_actors = actor_count;
+}
+
+// Discard the overlay and everything it created; timers that would run
+// overlay words are cancelled
+void reset_overlay() {
+    if (!base_dictionary) return;
+    if (compiling) {
+        free(compile_buffer);
+        compile_buffer = NULL;
+        compiling = 0;
+        current_word = NULL;
+    }
+    while (dictionary != base_dictionary) {
+        Word *next = dictionary->next;
+        free(dictionary->data);
+        free(dictionary);
+        dictionary = next;
+    }
+    while (actor_count > base_actors) {
+        Actor *a = actors[--actor_count];
+        chan_free(a->mailbox);
+        free(a);
+    }
+    while (coroutine_count > base_coroutines) {
+        Coroutine *co = coroutines[--coroutine_count];
+        cstack_free(co->cstack);
+        free(co);
+    }
+    for (int i = 0; i < MAX_TIMERS; i++) {
+        if (timers[i].active && timers[i].w->xt >= base_xt_count) {
+            timers[i].active = 0;
+        }
+    }
+    while (channel_count > base_channels) {
+        chan_free(channels[--channel_count]);
+    }
+    xt_count = base_xt_count;
+    here = base_here;
+}
+
+// Memory statistics: stack high-water marks, dictionary size split into
+// the frozen base and the overlay, data space and the C allocator
+void print_stats(FILE *f) {
+    int words[2] = { 0, 0 };
+    size_t bodies[2] = { 0, 0 };
+    int in_base = base_dictionary == NULL;
+    for (Word *w = dictionary; w; w = w->next) {
+        if (w == base_dictionary) in_base = 1;
+        words[in_base]++;
+        bodies[in_base] += w->data_len * sizeof(void*);
+    }
+    fprintf(f, "data stack:    %d of %d cells max\n", sp_max, STACK_SIZE);
+    fprintf(f, "return stack:  %d of %d cells max\n", rsp_max, STACK_SIZE);
+    fprintf(f, "dictionary:    %d words, %zu header bytes, %zu body bytes (base)\n",
+            words[1], words[1] * sizeof(Word), bodies[1]);
+    fprintf(f, "               %d words, %zu header bytes, %zu body bytes (overlay)\n",
+            words[0], words[0] * sizeof(Word), bodies[0]);
+    fprintf(f, "data space:    %d of %d cells\n", here, MEMORY_SIZE);
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || __GLIBC_MINOR__ >= 33)
+    struct mallinfo2 mi = mallinfo2();
+    fprintf(f, "malloc:        %zu bytes in use, %zu free, %zu mmapped, %zu arena\n",
+            mi.uordblks, mi.fordblks, mi.hblkhd, mi.arena);
+#endif
+}
+
+void stats() { print_stats(stdout); }
+
+// --stats prints the same report to stderr when the process exits
+void stats_at_exit() { print_stats(stderr); }
+
+// SEE <name> decompiles a word. Bodies are printed cell by cell exactly as
+// run_word executes them, with branch operands shown as offset and target.
+void see() {
+    Word *w = parse_word();
+    if (!w) return;
+    const char *where = w->xt < base_xt_count || !base_dictionary ? "base" : "overlay";
+    if (w->code) {
+        printf("%s is a primitive (xt %d, %s)%s\n", w->name, w->xt, where,
+               w->is_immediate ? " IMMEDIATE" : "");
+        return;
+    }
+    printf(": %s  \\ xt %d, %d cells, %s\n", w->name, w->xt, w->data_len, where);
+    for (int i = 0; i < w->data_len; i++) {
+        void *val = w->data[i];
+        if ((uintptr_t)val & 1) {
+            printf("%6d: %d\n", i, (int)((intptr_t)val >> 1));
+            continue;
+        }
+        Word *callee = (Word*)val;
+        if (has_operand(callee->xt) && i + 1 < w->data_len) {
+            int offset = (int)((intptr_t)w->data[i + 1] >> 1);
+            printf("%6d: %s %d -> %d\n", i, callee->name, offset, i + 1 + offset);
+            i++;
+        } else {
+            printf("%6d: %s\n", i, callee->name);
+        }
+    }
+    printf(";%s\n", w->is_immediate ? " IMMEDIATE" : "");
+}
+
+// Static analysis. A colon definition is walked once in cell order while
+// tracking the stack depth relative to entry. Compiled control flow is
+// structured, so a cell is first reached by a forward edge and back edges
+// only check that a loop leaves the depth unchanged. Cycle estimates take
+// the most expensive path using the rough costs below, counting each loop
+// body once and a recursive call as just the call.
+typedef struct PrimEffect {
+    const char *name;
+    int in, out;
+    int cost;  // Rough cycles including dispatch
+} PrimEffect;
+
+const PrimEffect prim_effects[] = {
+    { "+", 2, 1, 5 }, { "-", 2, 1, 5 }, { "*", 2, 1, 6 }, { "/", 2, 1, 30 },
+    { "MOD", 2, 1, 30 }, { "DUP", 1, 2, 4 }, { "DROP", 1, 0, 3 }, { "SWAP", 2, 2, 5 },
+    { "OVER", 2, 3, 4 }, { "ROT", 3, 3, 6 }, { "=", 2, 1, 5 }, { "<", 2, 1, 5 },
+    { ">", 2, 1, 5 }, { "AND", 2, 1, 5 }, { "OR", 2, 1, 5 }, { "NOT", 1, 1, 4 },
+    { "EMIT", 1, 0, 300 }, { "CR", 0, 0, 300 }, { ".", 1, 0, 400 }, { ".S", 0, 0, 2000 },
+    { "@", 1, 1, 6 }, { "!", 2, 0, 6 }, { "HERE", 0, 1, 4 }, { "ALLOT", 1, 0, 5 },
+    { ",", 1, 0, 6 }, { "ATOMIC@", 1, 1, 6 }, { "ATOMIC!", 2, 0, 25 },
+    { "ATOMIC+!", 2, 0, 25 }, { "CAS", 3, 1, 25 }, { "FENCE", 0, 0, 35 },
+    { "CHANNEL", 1, 1, 500 }, { "MPMC-CHANNEL", 1, 1, 500 }, { "SEND", 2, 0, 60 },
+    { "RECV", 1, 1, 60 }, { "PAR-MAP", 3, 0, 10000 }, { "PAR-REDUCE", 4, 1, 10000 },
+    { "ASYNC", 1, 1, 3000 }, { "AWAIT", 1, 1, 200 }, { "COROUTINE", 1, 1, 5000 },
+    { "RESUME", 1, 1, 300 }, { "YIELD", 1, 0, 300 }, { "DONE?", 1, 1, 5 },
+    { "ACTOR", 1, 1, 500 }, { "SEND-TO", 2, 0, 60 }, { "DISPATCH", 0, 0, 200 },
+    { "AFTER", 2, 0, 200 }, { "EVERY", 2, 1, 200 }, { "CANCEL", 1, 0, 20 },
+    { "MS", 1, 0, 1000 }, { "UTIME", 0, 1, 30 }, { "CYCLES", 0, 1, 30 },
+    { "FUEL", 1, 0, 5 }, { "FUEL@", 0, 1, 4 }, { "BRANCH", 0, 0, 3 },
+    { "0BRANCH", 1, 0, 4 }, { "(DO)", 2, 0, 8 }, { "(LOOP)", 0, 0, 6 },
+    { "I", 0, 1, 4 }, { "J", 0, 1, 4 },
+};
+
+#define LIT_COST 3    // Pushing an inline literal
+#define CALL_COST 10  // Entering and leaving a colon definition
+
+typedef struct Analysis {
+    int state;       // 0 not analyzed, 1 in progress, 2 done
+    int known;       // Every callee's effect is known
+    int balanced;    // All paths agree on the depth
+    int in, out;
+    int max_depth;   // Most items held at once, counting the inputs
+    int call_depth;  // Longest chain of colon calls below this word
+    int recursive;
+    int self_calls;
+    int loops;
+    long cost;
+} Analysis;
+
+Analysis analysis[DICT_SIZE];
+int analysis_stack[DICT_SIZE];  // Words being analyzed, for finding cycles
+int analysis_top = 0;
+
+const PrimEffect *prim_effect(const char *name) {
+    for (size_t i = 0; i < sizeof(prim_effects) / sizeof(prim_effects[0]); i++) {
+        if (strcasecmp(prim_effects[i].name, name) == 0) return &prim_effects[i];
+    }
+    return NULL;
+}
+
+void analyze_word(Word *w);
+
+// Effect and cost of one call in w's body. Returns 0 when the path through
+// it must be dropped: a call to w itself before w's effect is known.
+int call_effect(Word *w, Word *callee, int self_in, int self_out,
+                int *in, int *out, int *peak, long *cost) {
+    Analysis *a = &analysis[w->xt];
+    *in = *out = *peak = 0;
+    *cost = 0;
+    if (callee->code) {
+        const PrimEffect *p = prim_effect(callee->name);
+        if (!p) {
+            a->known = 0;  // EXECUTE, defining words and the like
+            return 1;
+        }
+        *in = p->in;
+        *out = p->out;
+        *peak = p->in > p->out ? p->in : p->out;
+        *cost = p->cost;
+        return 1;
+    }
+    analyze_word(callee);
+    Analysis *c = &analysis[callee->xt];
+    *cost = CALL_COST;
+    if (c->state == 1) {
+        // A cycle: every word from callee to the top of the stack is in it
+        for (int k = analysis_top - 1; k >= 0; k--) {
+            analysis[analysis_stack[k]].recursive = 1;
+            if (analysis_stack[k] == callee->xt) break;
+        }
+        if (callee != w) {
+            a->known = 0;
+            return 1;
+        }
+        a->self_calls = 1;
+        if (self_in < 0) return 0;
+        *in = self_in;
+        *out = self_out;
+        *peak = self_in > self_out ? self_in : self_out;
+        return 1;
+    }
+    if (!c->known || !c->balanced) a->known = 0;
+    if (c->call_depth + 1 > a->call_depth) a->call_depth = c->call_depth + 1;
+    *in = c->in;
+    *out = c->out;
+    *peak = c->max_depth;
+    *cost += c->cost;
+    return 1;
+}
+
+// One pass over w's body. self_in < 0 drops paths through calls to w
+// itself; otherwise those calls are taken to have the given effect.
+void walk_body(Word *w, int self_in, int self_out) {
+    Analysis *a = &analysis[w->xt];
+    int n = w->data_len;
+    int *depth = malloc((n + 1) * sizeof(int));
+    long *cost = malloc((n + 1) * sizeof(long));
+    char *reached = calloc(n + 1, 1);
+    int low = 0, high = 0;
+    a->known = 1;
+    a->balanced = 1;
+    a->loops = 0;
+    a->call_depth = 0;
+    reached[0] = 1;
+    depth[0] = 0;
+    cost[0] = 0;
+    for (int i = 0; i < n; i++) {
+        if (!reached[i]) continue;
+        void *val = w->data[i];
+        int in = 0, out = 1, peak = 1;
+        long c = LIT_COST;
+        int succ[2] = { i + 1, -1 };
+        if (!((uintptr_t)val & 1)) {
+            Word *callee = (Word*)val;
+            if (!call_effect(w, callee, self_in, self_out, &in, &out, &peak, &c)) continue;
+            if (has_operand(callee->xt)) {
+                int target = i + 1 + (int)((intptr_t)w->data[i + 1] >> 1);
+                // The target goes first so a loop's back edge is seen
+                // before its exit
+                succ[0] = target;
+                succ[1] = callee->xt == branch_xt ? -1 : i + 2;
+            }
+        }
+        int d = depth[i];
+        if (d - in < low) low = d - in;
+        if (d - in + peak > high) high = d - in + peak;
+        d += out - in;
+        c += cost[i];
+        for (int k = 0; k < 2; k++) {
+            int j = succ[k];
+            if (j < 0 || j > n) continue;
+            if (j <= i) {
+                // Exits already reached skipped the body, as WHILE's does;
+                // charge them one pass through it
+                a->loops = 1;
+                if (depth[j] != d) a->balanced = 0;
+                for (int m = i + 1; m <= n; m++) {
+                    if (reached[m]) cost[m] += c - cost[j];
+                }
+            } else if (reached[j]) {
+                if (depth[j] != d) a->balanced = 0;
+                if (c > cost[j]) cost[j] = c;
+            } else {
+                reached[j] = 1;
+                depth[j] = d;
+                cost[j] = c;
+            }
+        }
+    }
+    if (!reached[n]) {
+        a->known = 0;  // Never returns, or only through recursion
+        depth[n] = 0;
+        cost[n] = 0;
+    }
+    a->in = -low;
+    a->out = depth[n] - low;
+    a->max_depth = high - low;
+    a->cost = cost[n];
+    free(depth);
+    free(cost);
+    free(reached);
+}
+
+void analyze_word(Word *w) {
+    Analysis *a = &analysis[w->xt];
+    if (a->state || w->code) return;
+    a->state = 1;
+    analysis_stack[analysis_top++] = w->xt;
+    walk_body(w, -1, -1);
+    // A recursive word is first analyzed along its non-recursive paths;
+    // the effect found there is then checked against the recursive ones
+    if (a->self_calls && a->known) {
+        int in = a->in, out = a->out;
+        walk_body(w, in, out);
+        if (a->in != in || a->out != out) a->balanced = 0;
+    }
+    analysis_top--;
+    a->state = 2;
+}
+
+// ANALYZE reports every colon definition in definition order. Returns the
+// number of definitions whose paths disagree on the stack depth.
+int analyze_all() {
+    int bad = 0;
+    memset(analysis, 0, sizeof(analysis));
+    analysis_top = 0;
+    printf("%-20s %-14s %6s %6s %10s  %s\n", "word", "effect", "depth", "calls", "cycles", "notes");
+    for (int xt = 0; xt < xt_count; xt++) {
+        Word *w = xt_table[xt];
+        if (w->code) continue;
+        analyze_word(w);
+        Analysis *a = &analysis[xt];
+        char effect[32] = "?";
+        if (a->known && a->balanced) snprintf(effect, sizeof(effect), "( %d -- %d )", a->in, a->out);
+        char depth[16] = "?";
+        if (a->known) snprintf(depth, sizeof(depth), "%d", a->max_depth);
+        char notes[64] = "";
+        if (a->recursive) strcat(notes, " recursive");
+        if (a->loops) strcat(notes, " loops");
+        if (!a->balanced) strcat(notes, " unbalanced");
+        if (!a->known) strcat(notes, " unknown");
+        printf("%-20s %-14s %6s %6d %10ld%s%s\n", w->name, effect, depth, a->call_depth, a->cost,
+               *notes ? " " : "", notes);
+        bad += !a->balanced;
+    }
+    return bad;
+}
+
+void analyze() { analyze_all(); }
+
+// Main interpreter
+void interpret(char *input_line) {
+    input_ptr = input_line;
+    char word[WORD_SIZE];
+    
+    while (sscanf(input_ptr, "%s", word) == 1) {
+        input_ptr = strstr(input_ptr, word) + strlen(word);
+        
+        // Try to parse as number
+        char *endptr;
+        long num = strtol(word, &endptr, 10);
+        if (*endptr == '\0') {
+            if (compiling) {
+                // Tag the number with low bit set
+                void *tagged = (void*)((intptr_t)(num << 1) | 1);
+                compile_item(tagged);
+            } else {
+                push((int)num);
+            }
+            continue;
+        }
+        
+        // Look up in dictionary
+        Word *w = find_word(word);
+        if (w) {
+            if (compiling && !w->is_immediate) {
+                compile_item((void*)w);  // Store word pointer
+            } else {
                 execute_word(w);
             }
         } else {
@@ -271,12 +2748,13 @@ void interpret(char *input_line) {
 
 // Initialize dictionary
 void init_forth() {
+    epoch_ns = now_ns();
     add_word("+", add, 0);
     add_word("-", sub, 0);
     add_word("*", mul, 0);
     add_word("/", divide, 0);
     add_word("MOD", mod, 0);
-    add_word("DUP", dup, 0);
+    add_word("DUP", duplicate, 0);
     add_word("DROP", drop, 0);
     add_word("SWAP", swap, 0);
     add_word("OVER", over, 0);
@@ -291,26 +2769,735 @@ void init_forth() {
     add_word("AND", and, 0);
     add_word("OR", or, 0);
     add_word("NOT", not, 0);
+    add_word("CHANNEL", channel, 0);
+    add_word("MPMC-CHANNEL", mpmc_channel, 0);
+    add_word("SEND", channel_send, 0);
+    add_word("RECV", channel_recv, 0);
+    add_word("@", fetch, 0);
+    add_word("!", store, 0);
+    add_word("HERE", here_addr, 0);
+    add_word("ALLOT", allot, 0);
+    add_word(",", comma, 0);
+    add_word("ATOMIC@", atomic_fetch, 0);
+    add_word("ATOMIC!", atomic_store_cell, 0);
+    add_word("ATOMIC+!", atomic_add, 0);
+    add_word("CAS", cas, 0);
+    add_word("FENCE", fence, 0);
+    add_word("VARIABLE", variable, 0);
+    add_word("'", tick, 0);
+    add_word("[']", bracket_tick, 1);  // Immediate
+    add_word("EXECUTE", execute, 0);
+    add_word("PAR-MAP", par_map, 0);
+    add_word("PAR-REDUCE", par_reduce, 0);
+    add_word("ASYNC", async, 0);
+    add_word("AWAIT", await, 0);
+    add_word("COROUTINE", coroutine, 0);
+    add_word("RESUME", resume, 0);
+    add_word("YIELD", yield, 0);
+    add_word("DONE?", coroutine_done, 0);
+    add_word("ACTOR", actor, 0);
+    add_word("SEND-TO", send_to, 0);
+    add_word("DISPATCH", dispatch, 0);
+    add_word("UTIME", utime, 0);
+    add_word("CYCLES", cycles, 0);
+    add_word("BENCH", bench, 0);
+    add_word("AFTER", after, 0);
+    add_word("EVERY", every, 0);
+    add_word("CANCEL", cancel, 0);
+    add_word("MS", ms, 0);
+    add_word("FUEL", set_fuel, 0);
+    add_word("FUEL@", fuel_left, 0);
+    add_word("PROFILE-ON", profile_on, 0);
+    add_word("PROFILE-OFF", profile_off, 0);
+    add_word("PROFILE-REPORT", profile_report, 0);
+    add_word("SAMPLE-ON", sample_on, 0);
+    add_word("SAMPLE-OFF", sample_off, 0);
+    add_word("SAMPLE-DUMP", sample_dump, 0);
+    add_word("PERF-ON", perf_on, 0);
+    add_word("PERF-OFF", perf_off, 0);
+    add_word("PERF-REPORT", perf_report, 0);
+    add_word("PAIRS-ON", pairs_on, 0);
+    add_word("PAIRS-OFF", pairs_off, 0);
+    add_word("PAIRS-REPORT", pairs_report, 0);
+    add_word("TRACE-ON", trace_on, 0);
+    add_word("TRACE-OFF", trace_off, 0);
+    add_word("TRACE-DUMP", trace_dump, 0);
+    add_word("CHROME-TRACE", chrome_trace, 0);
+    add_word("CHROME-TRACE-OFF", chrome_trace_off, 0);
+    add_word("STATS", stats, 0);
+    add_word("SEE", see, 0);
+    add_word("ANALYZE", analyze, 0);
+    add_word("EMPTY", reset_overlay, 0);
+    add_word("\\", line_comment, 1);
+    add_word("(", paren_comment, 1);
+    add_word("BRANCH", branch, 0);
+    branch_xt = dictionary->xt;
+    add_word("0BRANCH", zero_branch, 0);
+    zbranch_xt = dictionary->xt;
+    add_word("(DO)", do_runtime, 0);
+    do_xt = dictionary->xt;
+    add_word("(LOOP)", loop_runtime, 0);
+    loop_xt = dictionary->xt;
+    add_word("I", loop_index, 0);
+    add_word("J", outer_index, 0);
+    add_word("IF", if_word, 1);
+    add_word("ELSE", else_word, 1);
+    add_word("THEN", then_word, 1);
+    add_word("BEGIN", begin_word, 1);
+    add_word("UNTIL", until_word, 1);
+    add_word("AGAIN", again_word, 1);
+    add_word("WHILE", while_word, 1);
+    add_word("REPEAT", repeat_word, 1);
+    add_word("DO", do_word, 1);
+    add_word("LOOP", loop_word, 1);
+    add_word("RECURSE", recurse, 1);
     add_word(":", colon, 0);
     add_word(";", semicolon, 1);  // Immediate
 }
 
-int main() {
+// Forget the words a runtime error unwound through
+void unwind_words() {
+    // Every coroutine between here and the top level was abandoned on its
+    // own C stack
+    for (Coroutine *co = current_co; co; co = co->resumer) {
+        co->done = 1;
+        co->running = 0;
+    }
+    current_co = NULL;
+    frame_depth = 0;
+    // The profilers never saw the aborted words return
+    for (int xt = 0; xt < xt_count; xt++) {
+        profile[xt].active = 0;
+    }
+    profile_child = 0;
+    memset(perf_child, 0, sizeof(perf_child));
+}
+
+// Reset this thread after a runtime error unwound to the top level
+void recover() {
+    unwind_words();
+    init_stacks();
+    if (compiling) {
+        end_compile();
+    }
+}
+
+// Interpret a line, recovering from runtime errors instead of exiting
+void interpret_line(char *line) {
+    jmp_buf point;
+    jmp_buf *saved = abort_point;
+    if (setjmp(point) == 0) {
+        abort_point = &point;
+        interpret(line);
+    } else {
+        recover();
+    }
+    abort_point = saved;
+}
+
+// Timers and actors that run between lines recover from errors the same way
+void service_events() {
+    jmp_buf point;
+    jmp_buf *saved = abort_point;
+    if (setjmp(point) == 0) {
+        abort_point = &point;
+        run_events(0);
+    } else {
+        recover();
+    }
+    abort_point = saved;
+}
+
+// Line input for the REPL and worker jobs. Unlike fgets() it knows when no
+// complete line is buffered, so it can wait in epoll on the input and the
+// timer ticks together and run timers while the input is idle.
+typedef struct LineInput {
+    int fd;
+    int start;
+    int end;
+    int eof;
+    int ready;  // The input became readable while waiting
+    char buf[4096];
+} LineInput;
+
+void line_input_init(LineInput *in, int fd) {
+    in->fd = fd;
+    in->start = 0;
+    in->end = 0;
+    in->eof = 0;
+    in->ready = 0;
+}
+
+void wait_step(void *arg) {
+    LineInput *in = arg;
+    advance_wheel(0);  // Left over when a callback failed
+    struct epoll_event ev[2];
+    int n = epoll_wait(event_fd, ev, 2, -1);
+    if (n < 0 && errno != EINTR) in->ready = 1;  // Let read() report it
+    for (int i = 0; i < n; i++) {
+        if (ev[i].data.fd == in->fd) in->ready = 1;
+    }
+    for (int i = 0; i < n; i++) {
+        if (ev[i].data.fd == timer_fd) take_ticks();
+    }
+    dispatch_actors();
+    fflush(stdout);
+}
+
+// Returns once fd is readable or no timer is left to run. A callback that
+// fails is abandoned without touching the stack or a definition the user
+// is halfway through typing.
+void wait_input(LineInput *in) {
+    if (pending_timers == 0) return;
+    struct epoll_event ev = { .events = EPOLLIN, .data.fd = in->fd };
+    if (epoll_ctl(event_fd, EPOLL_CTL_ADD, in->fd, &ev) != 0) {
+        return;  // Regular files are always readable
+    }
+    int saved_sp = sp, saved_rsp = rsp;
+    in->ready = 0;
+    while (!in->ready && pending_timers > 0) {
+        if (!run_caught(wait_step, in)) {
+            unwind_words();
+            stack = thread_stack;
+            rstack = thread_rstack;
+            sp = saved_sp;
+            rsp = saved_rsp;
+        }
+    }
+    epoll_ctl(event_fd, EPOLL_CTL_DEL, in->fd, NULL);
+}
+
+// Like fgets(): returns 0 at end of input, otherwise one line including
+// its newline, split if it does not fit in size
+int read_line(LineInput *in, char *line, int size) {
+    while (1) {
+        int avail = in->end - in->start;
+        char *nl = memchr(in->buf + in->start, '\n', avail);
+        if (nl || avail >= size - 1 || (in->eof && avail > 0)) {
+            int n = nl ? (int)(nl - (in->buf + in->start)) + 1 : avail;
+            if (n > size - 1) n = size - 1;
+            memcpy(line, in->buf + in->start, n);
+            line[n] = 0;
+            in->start += n;
+            return 1;
+        }
+        if (in->eof) return 0;
+        memmove(in->buf, in->buf + in->start, avail);
+        in->start = 0;
+        in->end = avail;
+        fflush(stdout);
+        wait_input(in);
+        ssize_t got = read(in->fd, in->buf + in->end, sizeof(in->buf) - in->end);
+        if (got < 0 && errno == EINTR) continue;
+        if (got <= 0) {
+            in->eof = 1;
+        } else {
+            in->end += got;
+        }
+    }
+}
+
+int load_file(const char *path) {
+    FILE *f = fopen(path, "r");
+    if (!f) {
+        printf("Cannot open %s\n", path);
+        return -1;
+    }
+    char line[INPUT_SIZE];
+    while (fgets(line, INPUT_SIZE, f)) {
+        line[strcspn(line, "\n")] = 0;
+        interpret(line);
+        run_events(0);
+    }
+    fclose(f);
+    return 0;
+}
+
+// Worker pool: the parent loads the libraries once and forks workers that
+// share the dictionary pages copy-on-write. Workers accept jobs from one
+// listening socket; each connection is a job whose lines are interpreted
+// with stdout sent back over the connection.
+volatile sig_atomic_t stop_workers = 0;
+
+void on_stop_signal(int sig) {
+    (void)sig;
+    stop_workers = 1;
+}
+
+// Per-job call budget from --fuel, 0 for unmetered jobs
+long job_fuel = 0;
+
+void serve_job(int fd) {
+    LineInput in;
+    line_input_init(&in, fd);
+    fflush(stdout);
+    int saved_stdout = dup(STDOUT_FILENO);
+    dup2(fd, STDOUT_FILENO);
+    sp = 0;
+    rsp = 0;
+
+    char line[INPUT_SIZE];
+    if (job_fuel > 0) {
+        fuel = job_fuel;
+        hooks |= HOOK_FUEL;
+    }
+    while (read_line(&in, line, INPUT_SIZE)) {
+        line[strcspn(line, "\n")] = 0;
+        interpret_line(line);
+        service_events();
+        fflush(stdout);
+    }
+    // Nothing a job switched on or stored may reach the next connection
+    profile_off();
+    trace_off();
+    pairs_off();
+    perf_off();
+    sample_off();
+    chrome_trace_off();
+    hooks = 0;
+    fuel = 0;
+    memset(profile, 0, sizeof(profile));
+    memset(perf_counts, 0, sizeof(perf_counts));
+    memset(samples, 0, sizeof(samples));
+    samples_dropped = 0;
+    memset(&dynamic_pairs, 0, sizeof(dynamic_pairs));
+    memset(&dynamic_triples, 0, sizeof(dynamic_triples));
+    trace_pos = 0;
+    if (here > base_here) {
+        memset(&memory[base_here], 0, (here - base_here) * sizeof(int));
+    }
+    reset_events();
+    reset_overlay();
+
+    fflush(stdout);
+    dup2(saved_stdout, STDOUT_FILENO);
+    close(saved_stdout);
+    close(fd);
+}
+
+pid_t spawn_worker(int server) {
+    pid_t pid = fork();
+    if (pid != 0) return pid;
+
+    signal(SIGTERM, SIG_DFL);
+    signal(SIGINT, SIG_DFL);
+    pool_reset();
+    while (1) {
+        int fd = accept(server, NULL, NULL);
+        if (fd < 0) {
+            if (errno == EINTR) continue;
+            _exit(1);
+        }
+        serve_job(fd);
+    }
+}
+
+int run_workers(int count, const char *path) {
+    if (count > MAX_WORKERS) count = MAX_WORKERS;
+
+    int server = socket(AF_UNIX, SOCK_STREAM, 0);
+    struct sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strncpy(addr.sun_path, path, sizeof(addr.sun_path) - 1);
+    unlink(path);
+    if (server < 0 || bind(server, (struct sockaddr*)&addr, sizeof(addr)) < 0 ||
+        listen(server, 128) < 0) {
+        perror(path);
+        return 1;
+    }
+
+    struct sigaction sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = on_stop_signal;
+    sigaction(SIGTERM, &sa, NULL);
+    sigaction(SIGINT, &sa, NULL);
+
+    fflush(stdout);
+    // Start as many workers as fork() allows, up to count
+    pid_t pids[MAX_WORKERS];
+    int started = 0;
+    while (started < count) {
+        pid_t pid = spawn_worker(server);
+        if (pid < 0) {
+            perror("fork");
+            break;
+        }
+        pids[started++] = pid;
+    }
+    if (started == 0) {
+        close(server);
+        unlink(path);
+        return 1;
+    }
+    count = started;
+    fprintf(stderr, "%d workers listening on %s\n", count, path);
+
+    // Replace workers that die until we are told to stop. A slot whose
+    // fork failed holds 0 and is retried on the next pass.
+    while (!stop_workers) {
+        int missing = 0;
+        for (int i = 0; i < count; i++) {
+            if (pids[i] > 0) continue;
+            pids[i] = spawn_worker(server);
+            if (pids[i] < 0) {
+                perror("fork");
+                pids[i] = 0;
+                missing++;
+            }
+        }
+        pid_t pid = wait(NULL);
+        if (pid < 0) {
+            if (errno == EINTR) continue;
+            if (errno == ECHILD && missing) {
+                sleep(1);
+                continue;
+            }
+            break;
+        }
+        for (int i = 0; i < count; i++) {
+            if (pids[i] == pid) pids[i] = 0;
+        }
+    }
+
+    for (int i = 0; i < count; i++) {
+        if (pids[i] > 0) kill(pids[i], SIGTERM);
+    }
+    while (wait(NULL) > 0) {
+    }
+    close(server);
+    unlink(path);
+    return 0;
+}
+
+// Batch runner: every job is a script run in a child forked from the
+// initialized interpreter, so jobs skip exec and init_forth() and cannot
+// disturb each other. Each job's output goes to its own temporary file and
+// is copied to stdout in job order once all earlier jobs have finished.
+typedef struct Job {
+    const char *path;
+    pid_t pid;
+    FILE *out;
+    int status;
+    int done;
+} Job;
+
+void emit_job(Job *j) {
+    char buf[4096];
+    size_t n;
+    rewind(j->out);
+    while ((n = fread(buf, 1, sizeof(buf), j->out)) > 0) {
+        fwrite(buf, 1, n, stdout);
+    }
+    fclose(j->out);
+}
+
+int run_jobs(int parallel, char **paths, int count) {
+    Job *jobs = calloc(count, sizeof(Job));
+    int next = 0, running = 0, emitted = 0, failed = 0;
+
+    fflush(stdout);
+    while (emitted < count) {
+        // A finished job keeps its output file open until every earlier job
+        // has been emitted, so at most JOB_BACKLOG of them may be waiting.
+        // When files or processes run out, wait for an earlier job instead
+        // of failing this one.
+        while (running < parallel && next < count &&
+               next - emitted < parallel + JOB_BACKLOG) {
+            Job *j = &jobs[next];
+            j->path = paths[next];
+            j->out = tmpfile();
+            j->pid = j->out ? fork() : -1;
+            if (j->pid < 0 && next > emitted) {
+                if (j->out) fclose(j->out);
+                j->out = NULL;
+                break;
+            }
+            next++;
+            if (j->pid == 0) {
+                // Other jobs' output files are not ours; free the descriptors
+                for (int k = emitted; k < next; k++) {
+                    if (jobs[k].out && &jobs[k] != j) close(fileno(jobs[k].out));
+                }
+                dup2(fileno(j->out), STDOUT_FILENO);
+                pool_reset();
+                if (job_fuel > 0) {
+                    fuel = job_fuel;
+                    hooks |= HOOK_FUEL;
+                }
+                int rc = load_file(j->path) != 0;
+                fflush(stdout);
+                _exit(rc);
+            }
+            if (j->pid < 0) {
+                j->done = 1;
+                j->status = -1;
+            } else {
+                running++;
+            }
+        }
+
+        int status;
+        pid_t pid = running > 0 ? wait(&status) : -1;
+        for (int k = emitted; pid > 0 && k < next; k++) {
+            if (jobs[k].pid == pid && !jobs[k].done) {
+                jobs[k].done = 1;
+                jobs[k].status = status;
+                running--;
+            }
+        }
+        while (emitted < next && jobs[emitted].done) {
+            Job *j = &jobs[emitted++];
+            if (j->out) {
+                emit_job(j);
+            }
+            fflush(stdout);
+            if (j->status != 0) {
+                fprintf(stderr, "Job failed: %s\n", j->path);
+                failed = 1;
+            }
+        }
+    }
+    free(jobs);
+    return failed;
+}
+
+// Read a job list, one script path per line
+int read_job_list(FILE *f, char ***paths) {
+    int count = 0, size = 64;
+    char line[4096];
+    *paths = malloc(size * sizeof(char*));
+    while (fgets(line, sizeof(line), f)) {
+        line[strcspn(line, "\n")] = 0;
+        if (line[0] == '\0') continue;
+        if (count >= size) {
+            size *= 2;
+            *paths = realloc(*paths, size * sizeof(char*));
+        }
+        (*paths)[count++] = strdup(line);
+    }
+    return count;
+}
+
+// --bench FILE runs every BENCH-* word the file defines and prints the
+// results as JSON in the same shape as bench/run.sh, but timing only the
+// word, not process start-up. The JSON records that as "method": "word"
+// against run.sh's "process". With --baseline each median is compared to
+// an earlier --bench result, and a benchmark slower by more than
+// --threshold percent makes the exit status non-zero.
+int bench_runs = 10;
+const char *bench_baseline = NULL;
+double bench_threshold = 10.0;
+
+int by_u64(const void *a, const void *b) {
+    uint64_t x = *(const uint64_t*)a, y = *(const uint64_t*)b;
+    return x < y ? -1 : x > y ? 1 : 0;
+}
+
+char *read_file(const char *path) {
+    FILE *f = fopen(path, "r");
+    if (!f) return NULL;
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    rewind(f);
+    char *text = malloc(size + 1);
+    text[fread(text, 1, size, f)] = '\0';
+    fclose(f);
+    return text;
+}
+
+// Median of a benchmark in baseline JSON, or -1 if it is not listed
+double baseline_median(const char *json, const char *name) {
+    char key[WORD_SIZE + 16];
+    snprintf(key, sizeof(key), "\"name\": \"%s\"", name);
+    const char *p = strstr(json, key);
+    if (!p || !(p = strstr(p, "\"median_ns\":"))) return -1;
+    return strtod(p + strlen("\"median_ns\":"), NULL);
+}
+
+int run_bench(const char *path) {
+    char *baseline = NULL;
+    if (bench_baseline && !(baseline = read_file(bench_baseline))) {
+        fprintf(stderr, "Cannot open %s\n", bench_baseline);
+        return 1;
+    }
+    // Whole-process times include start-up and loading, so they are
+    // always slower and would hide any regression
+    if (baseline && !strstr(baseline, "\"method\": \"word\"")) {
+        fprintf(stderr, "Baseline %s was not made by --bench; "
+                "only compare against results measured the same way\n", bench_baseline);
+        free(baseline);
+        return 1;
+    }
+
+    // Output from the benchmarks themselves is discarded so stdout is
+    // only the JSON
+    fflush(stdout);
+    FILE *json = fdopen(dup(STDOUT_FILENO), "w");
+    freopen("/dev/null", "w", stdout);
+    if (load_file(path) != 0) {
+        fprintf(stderr, "Cannot open %s\n", path);
+        return 1;
+    }
+
+    Word *words[DICT_SIZE];
+    int count = 0;
+    for (Word *w = dictionary; w; w = w->next) {
+        if (strncmp(w->name, "BENCH-", 6) == 0 && !w->code && find_word(w->name) == w) {
+            words[count++] = w;
+        }
+    }
+
+    int fd = perf_open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS, -1);
+    if (fd >= 0) ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+
+    uint64_t *ns = malloc(bench_runs * sizeof(uint64_t));
+    uint64_t *insns = malloc(bench_runs * sizeof(uint64_t));
+    int regressed = 0, missing = 0, measured = 0;
+    fprintf(json, "{\"method\": \"word\", \"runs\": %d, \"benchmarks\": [", bench_runs);
+    fprintf(stderr, "%-20s %14s %14s %16s %8s\n", "benchmark", "median_ns", "p99_ns",
+            "instructions", "change");
+    // The dictionary is newest first; run in definition order
+    for (int k = count - 1; k >= 0; k--) {
+        Word *w = words[k];
+        // Named like bench/run.sh: BENCH-FIB is "fib"
+        char name[WORD_SIZE];
+        for (int i = 0; (name[i] = tolower((unsigned char)w->name[6 + i])); i++) {
+        }
+        // An empty word leaves all the work to loading the file, which only
+        // bench/run.sh times
+        if (w->data_len == 0) {
+            fprintf(stderr, "%-20s %14s\n", name, "skipped");
+            continue;
+        }
+        int base = sp;
+        for (int i = 0; i < bench_runs / 10 + 1; i++) {
+            execute_word(w);
+            sp = base;
+        }
+        for (int i = 0; i < bench_runs; i++) {
+            uint64_t before[2] = { 0, 0 }, after[2] = { 0, 0 };
+            if (fd >= 0 && read(fd, before, sizeof(before)) <= 0) before[1] = 0;
+            uint64_t start = now_ns();
+            execute_word(w);
+            ns[i] = now_ns() - start;
+            if (fd >= 0 && read(fd, after, sizeof(after)) <= 0) after[1] = 0;
+            insns[i] = after[1] - before[1];
+            sp = base;
+        }
+        qsort(ns, bench_runs, sizeof(uint64_t), by_u64);
+        qsort(insns, bench_runs, sizeof(uint64_t), by_u64);
+        int mid = (bench_runs - 1) / 2;
+        uint64_t median = ns[mid];
+        uint64_t p99 = ns[(bench_runs * 99 + 99) / 100 - 1];
+
+        char instructions[32] = "null";
+        if (fd >= 0) snprintf(instructions, sizeof(instructions), "%llu",
+                              (unsigned long long)insns[mid]);
+        char change[16] = "";
+        double old = baseline ? baseline_median(baseline, name) : -1;
+        if (old > 0) {
+            double pct = 100.0 * (median - old) / old;
+            snprintf(change, sizeof(change), "%+.1f%%", pct);
+            if (pct > bench_threshold) regressed++;
+        } else if (baseline) {
+            snprintf(change, sizeof(change), "missing");
+            missing++;
+        }
+        fprintf(json, "%s{\"name\": \"%s\", \"median_ns\": %llu, \"p99_ns\": %llu, \"instructions\": %s}",
+                measured++ ? ", " : "", name, (unsigned long long)median,
+                (unsigned long long)p99, instructions);
+        fprintf(stderr, "%-20s %14llu %14llu %16s %8s\n", name, (unsigned long long)median,
+                (unsigned long long)p99, instructions, change);
+    }
+    fprintf(json, "]}\n");
+    fclose(json);
+    if (regressed) {
+        fprintf(stderr, "Regression in %d of %d benchmarks (threshold %.1f%%, baseline %s)\n",
+                regressed, measured, bench_threshold, bench_baseline);
+    }
+    if (missing) {
+        fprintf(stderr, "Missing from baseline %s: %d of %d benchmarks\n",
+                bench_baseline, missing, measured);
+    }
+    return regressed || missing;
+}
+
+int main(int argc, char **argv) {
+    init_stacks();
     init_forth();
+
+    int workers = 0;
+    int jobs = 0;
+    int analyze_only = 0;
+    const char *bench_file = NULL;
+    const char *socket_path = "/tmp/forth_mini.sock";
+    char **files = malloc(argc * sizeof(char*));
+    int file_count = 0;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--workers") == 0 && i + 1 < argc) {
+            workers = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--socket") == 0 && i + 1 < argc) {
+            socket_path = argv[++i];
+        } else if (strcmp(argv[i], "--jobs") == 0 && i + 1 < argc) {
+            jobs = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--bench") == 0 && i + 1 < argc) {
+            bench_file = argv[++i];
+        } else if (strcmp(argv[i], "--baseline") == 0 && i + 1 < argc) {
+            bench_baseline = argv[++i];
+        } else if (strcmp(argv[i], "--threshold") == 0 && i + 1 < argc) {
+            bench_threshold = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--runs") == 0 && i + 1 < argc) {
+            bench_runs = atoi(argv[++i]) > 0 ? atoi(argv[i]) : 1;
+        } else if (strcmp(argv[i], "--analyze") == 0) {
+            analyze_only = 1;
+        } else if (strcmp(argv[i], "--stats") == 0) {
+            atexit(stats_at_exit);
+        } else if (strcmp(argv[i], "--fuel") == 0 && i + 1 < argc) {
+            job_fuel = atol(argv[++i]);
+        } else {
+            files[file_count++] = argv[i];
+        }
+    }
+    if (jobs > 0) {
+        if (file_count == 0) {
+            file_count = read_job_list(stdin, &files);
+        }
+        freeze_base();
+        return run_jobs(jobs, files, file_count);
+    }
+    for (int i = 0; i < file_count; i++) {
+        if (load_file(files[i]) != 0) {
+            return 1;
+        }
+    }
+    if (bench_file) {
+        return run_bench(bench_file);
+    }
+    if (analyze_only) {
+        return analyze_all() != 0;
+    }
+    freeze_base();
+    if (workers > 0) {
+        return run_workers(workers, socket_path);
+    }
     
     printf("Simple Forth Interpreter\n");
     printf("Type 'exit' to quit\n\n");
     
+    LineInput in;
+    line_input_init(&in, STDIN_FILENO);
     while (1) {
         printf(compiling ? "... " : "ok> ");
-        if (!fgets(input, INPUT_SIZE, stdin)) break;
+        if (!read_line(&in, input, INPUT_SIZE)) break;
         
         // Remove newline
         input[strcspn(input, "\n")] = 0;
         
         if (strcmp(input, "exit") == 0) break;
         
-        interpret(input);
+        interpret_line(input);
+        service_events();
     }
     
     return 0;